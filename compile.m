@@ -7,6 +7,11 @@ function compile
 %
 %   On success, JIGSAW is installed in ../external/jigsaw.
 %
+%   If a MEX compiler is configured (see MEX -SETUP), COMPI-
+%   LE also builds JIGSAW_MEX, an "in-process" gateway to
+%   lib_jigsaw used automatically by JIGSAW, TRIPOD and MAR-
+%   CHE. Otherwise, these fall back on the executables.
+%
 %   The cmake workflow has been tested on various Linux, Mac
 %   and Windows-based systems, using the gcc, clang and msvc
 %   compilers.
@@ -49,6 +54,8 @@ function compile
 
    [okay] = rmdir([here,'/external/jigsaw/build'], 's');
 
+    compile_mex(here) ;
+
     catch err
 
     cd(here) ;
@@ -61,5 +68,50 @@ function compile
 
 end
 
+function compile_mex(here)
+%COMPILE_MEX build the JIGSAW_MEX gateway, linking against
+%the lib_jigsaw installed in ../external/jigsaw/lib.
+
+    incdir = [here,'/external/jigsaw/inc'] ;
+    libdir = [here,'/external/jigsaw/lib'] ;
+    srcmex = [here,'/jigsaw_mex.cpp'] ;
+
+    try
+
+    if (exist('OCTAVE_VERSION', 'builtin') > 0)
+
+        mex('-o', [here,'/jigsaw_mex.mex'], ...
+            ['-I',incdir], ['-L',libdir], '-ljigsaw', ...
+            ['-Wl,-rpath,',libdir], srcmex) ;
+
+    elseif (ispc())
+
+        mex('-outdir', here, ...
+            ['-I',incdir], ['-L',libdir], '-ljigsaw', ...
+            srcmex) ;
+
+    %-- the dll must be found next to the MEX on windows
+        copyfile([libdir,'\jigsaw.dll'], here) ;
+
+    else
+
+        mex('-outdir', here, ...
+            ['-I',incdir], ['-L',libdir], '-ljigsaw', ...
+           ['LDFLAGS=$LDFLAGS -Wl,-rpath,',libdir], ...
+            srcmex) ;
+
+    end
+
+    catch err
+
+        warning([ ...
+        'JIGSAW_MEX not compiled -- ', err.message, ...
+        ' JIGSAW will call its executables instead.', ...
+            ] ) ;
+
+    end
+
+end
+
 
 
@@ -87,6 +87,9 @@
 #       define JIGSAW_HFUN_RELATIVE  +300
 #       define JIGSAW_HFUN_ABSOLUTE  +301
 
+#       define JIGSAW_HFUN_MARCHING  +302
+#       define JIGSAW_HFUN_SWEEPING  +303
+
 #       define JIGSAW_KERN_DELFRONT  +400
 #       define JIGSAW_KERN_DELAUNAY  +401
 #       define JIGSAW_KERN_BISECTOR  +402
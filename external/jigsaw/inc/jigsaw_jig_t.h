@@ -120,6 +120,33 @@
 
         real_t                  _init_near ;
 
+    /*
+    --------------------------------------------------------
+     * INIT_KEEP - {default = false} treat the initial set
+     * as a previous mesh, and re-mesh it incrementally:
+     * only cells that violate the current H(x), plus a
+     * "halo" of INIT_HALO rings of adj. cells, are re-
+     * meshed. All other cells are kept as-is. Disjoint
+     * regions are re-meshed separately, each grown by
+     * further rings and re-tried if it fails. If any part
+     * still fails, the GEOM. has changed, or INIT_KEEP is
+     * not supported for the mesh type, a full re-build is
+     * done instead.
+    --------------------------------------------------------
+     */
+
+        indx_t                  _init_keep ;
+
+    /*
+    --------------------------------------------------------
+     * INIT_HALO - {default = 2} number of rings of adj.
+     * cells added about each re-meshed region when
+     * INIT_KEEP is enabled.
+    --------------------------------------------------------
+     */
+
+        indx_t                  _init_halo ;
+
     /*
     --------------------------------------------------------
      * HFUN_SCAL - {default = 'relative'} scaling type for
@@ -151,6 +178,33 @@
 
         real_t                  _hfun_hmin ;
 
+    /*
+    --------------------------------------------------------
+     * HFUN_CLIP - {default = 'marching'} solver used to
+     * impose gradient-limits on mesh-size functions in
+     * MARCHE. CLIP = 'marching' is a serial, heap-based
+     * fast-marching method. CLIP = 'sweeping' is a tiled
+     * fast-sweeping method, run over HFUN_CPUS threads,
+     * and applies to 2-dim. EUCLIDEAN-GRID and ELLIPSOID-
+     * GRID data only (unstructured H(x) always use
+     * 'marching'). It is ignored, with a notice, for
+     * 3-dim. EUCLIDEAN-GRID data, for which gradient-
+     * limits are not supported by either solver.
+    --------------------------------------------------------
+     */
+
+        indx_t                  _hfun_clip ;
+
+    /*
+    --------------------------------------------------------
+     * HFUN_CPUS - {default=1} number of threads used for
+     * HFUN_CLIP = 'sweeping'. Results are deterministic,
+     * and do not vary with CPUS.
+    --------------------------------------------------------
+     */
+
+        indx_t                  _hfun_cpus ;
+
     /*
     --------------------------------------------------------
      * BNDS_KERN - {default = 'bnd-tria'} placement of bou-
@@ -174,6 +228,20 @@
 
         indx_t                  _mesh_dims ;
 
+    /*
+    --------------------------------------------------------
+     * MESH_CPUS - {default=1} number of threads used to
+     * build the Delaunay tessellation of the INIT nodes in
+     * TRIPOD. CPUS > 1 searches for node "cavities"
+     * concurrently, but inserts nodes in the same order as
+     * CPUS=1. The tessellation is identical to CPUS=1,
+     * including for "degenerate" inputs (e.g. structured
+     * grids). JIGSAW seeds its INIT nodes serially.
+    --------------------------------------------------------
+     */
+
+        indx_t                  _mesh_cpus ;
+
     /*
     --------------------------------------------------------
      * MESH_KERN - {default = 'delfront'} meshing kernel,
@@ -437,6 +505,19 @@
 
         indx_t                  _optm_div_ ;
 
+    /*
+    --------------------------------------------------------
+     * OPTM_CPUS - {default=1} number of threads used for
+     * node "smoothing" passes. CPUS > 1 relaxes nodes in
+     * "colour" sets of independent vertices (no shared
+     * cells), each set being updated concurrently. Results
+     * are deterministic, and do not vary with CPUS > 1.
+     * Topological "flip" and "zip" passes remain serial.
+    --------------------------------------------------------
+     */
+
+        indx_t                  _optm_cpus ;
+
         } jigsaw_jig_t ;
 
 
@@ -557,23 +557,15 @@
         try
         {
             jmsh_reader   _jmsh ;
-            std::ifstream _file ;
-            _file. open(
-            _jcfg._hfun_file, std::ifstream::in) ;
 
-            if (_file.is_open() )
-            {
-                _jmsh.read_file (
-                _file, hfun_reader(&_hfun));
-            }
-            else
+            if (!_jmsh.read_file (
+            _jcfg._hfun_file, hfun_reader(&_hfun)))
             {
                 _jlog.push(
             "**parse error: file not found!\n" ) ;
 
                 _errv = __file_not_located ;
             }
-            _file.close ();
 
             for (auto _iter  =
                       _jmsh._errs.head();
@@ -1058,7 +1050,7 @@
             }
 
             for (auto _ipos = (size_t) +0 ;
-                _ipos != _hmsh._value._size ;
+                _ipos != _hmsh._slope._size ;
                     ++_ipos )
             {
                 _hfun._ellipsoid_grid_3d.
@@ -338,23 +338,15 @@
         try
         {
             jmsh_reader   _jmsh ;
-            std::ifstream _file ;
-            _file. open(
-            _jcfg._init_file, std::ifstream::in) ;
 
-            if (_file.is_open() )
-            {
-                _jmsh.read_file (
-                _file, init_reader(&_init));
-            }
-            else
+            if (!_jmsh.read_file (
+            _jcfg._init_file, init_reader(&_init)))
             {
                 _jlog.push(
             "**parse error: file not found!\n" ) ;
 
                 _errv = __file_not_located ;
             }
-            _file.close ();
 
             for (auto _iter  =
                       _jmsh._errs.head();
@@ -177,6 +177,21 @@
            _jjig->_hfun_hmin = _hmin;
         }
 
+        __normal_call void_type push_hfun_clip (
+            std::int32_t  _clip
+            )
+        {
+            this->_jjig->_hfun_clip =
+        (jcfg_data::hfun_clip::enum_data)_clip ;
+        }
+        __normal_call void_type push_hfun_cpus (
+            std::int32_t  _cpus
+            )
+        {
+            this->
+           _jjig->_hfun_cpus = _cpus;
+        }
+
     /*------------------------------------- INIT keywords */
         __normal_call void_type push_init_file (
             std::string   _file
@@ -185,6 +200,20 @@
             this->
            _jjig->_init_file = _file;
         }
+        __normal_call void_type push_init_keep (
+            bool          _keep
+            )
+        {
+            this->
+           _jjig->_init_keep = _keep;
+        }
+        __normal_call void_type push_init_halo (
+            std::int32_t  _halo
+            )
+        {
+            this->
+           _jjig->_init_halo = _halo;
+        }
 
     /*------------------------------------- BNDS keywords */
         __normal_call void_type push_bnds_kern (
@@ -225,6 +254,20 @@
             this->
            _jjig->_bnds_file = _file;
         }
+        __normal_call void_type push_file_bins (
+            bool          _flag
+            )
+        {
+            this->
+           _jjig->_file_bins = _flag;
+        }
+        __normal_call void_type push_stat_file (
+            std::string   _file
+            )
+        {
+            this->
+           _jjig->_stat_file = _file;
+        }
 
         __normal_call void_type push_mesh_dims (
             std::int32_t  _dims
@@ -233,6 +276,13 @@
             this->_jjig->
            _mesh_opts.dims() = _dims;
         }
+        __normal_call void_type push_mesh_cpus (
+            std::int32_t  _cpus
+            )
+        {
+            this->_jjig->
+           _mesh_opts.cpus() = _cpus;
+        }
         __normal_call void_type push_mesh_iter (
             std::int32_t  _iter
             )
@@ -404,6 +454,13 @@
             this->_jjig->
            _iter_opts.zip_() = _flag;
         }
+        __normal_call void_type push_optm_cpus (
+            std::int32_t  _cpus
+            )
+        {
+            this->_jjig->
+           _iter_opts.cpus() = _cpus;
+        }
 
         } ;
 
@@ -507,6 +564,11 @@
             _jcfg._mesh_opts.
                 near() = _jjig._init_near ;
 
+            _jcfg._init_keep =
+                _jjig._init_keep != +0 ;
+            _jcfg._init_halo =
+                _jjig._init_halo ;
+
     /*------------------------------------- HFUN keywords */
             if (_jjig._hfun_scal ==
                     JIGSAW_HFUN_RELATIVE)
@@ -525,6 +587,21 @@
             _jcfg.
             _hfun_hmin = _jjig._hfun_hmin ;
 
+            if (_jjig._hfun_clip ==
+                    JIGSAW_HFUN_MARCHING)
+            _jcfg._hfun_clip =
+                jcfg_data::hfun_clip::marching ;
+            else
+            if (_jjig._hfun_clip ==
+                    JIGSAW_HFUN_SWEEPING)
+            _jcfg._hfun_clip =
+                jcfg_data::hfun_clip::sweeping ;
+            else
+            _errv = __invalid_useropts ;
+
+            _jcfg.
+            _hfun_cpus = _jjig._hfun_cpus ;
+
     /*------------------------------------- RDEL keywords */
             if (_jjig._mesh_kern ==
                     JIGSAW_KERN_DELFRONT)
@@ -545,6 +622,8 @@
 
             _jcfg._mesh_opts.
                 dims() = _jjig._mesh_dims ;
+            _jcfg._mesh_opts.
+                cpus() = _jjig._mesh_cpus ;
             _jcfg._mesh_opts.
                 iter() = _jjig._mesh_iter ;
 
@@ -609,6 +688,9 @@
             _jcfg._iter_opts.
                 zip_() = _jjig._optm_zip_ ;
 
+            _jcfg._iter_opts.
+                cpus() = _jjig._optm_cpus ;
+
         }
         catch (...)
         {
@@ -714,6 +796,11 @@
             (real_type)  0.,
             (real_type)  1.)
 
+        __testINTS("INIT-HALO",
+            _jcfg._init_halo,
+            (iptr_type) + 0,
+        std::numeric_limits<iptr_type>::     max())
+
     /*---------------------------- test HFUN keywords */
         __testREAL("HFUN-HMAX",
             _jcfg ._hfun_hmax ,
@@ -724,6 +811,11 @@
             (real_type)  0.,
         std::numeric_limits<real_type>::infinity())
 
+        __testINTS("HFUN-CPUS",
+            _jcfg ._hfun_cpus ,
+            (iptr_type) + 1,
+        std::numeric_limits<iptr_type>::     max())
+
     /*---------------------------- test MESH keywords */
         __testINTS("MESH-ITER",
             _jcfg._mesh_opts.iter(),
@@ -735,6 +827,11 @@
             (iptr_type) + 1,
             (iptr_type) + 3)
 
+        __testINTS("MESH-CPUS",
+            _jcfg._mesh_opts.cpus(),
+            (iptr_type) + 1,
+        std::numeric_limits<iptr_type>::     max())
+
         __testREAL("MESH-SIZ1",
             _jcfg._mesh_opts.siz1(),
             (real_type)  0.,
@@ -818,6 +915,11 @@
             (real_type)  0.,
             (real_type)  1.)
 
+        __testINTS("OPTM-CPUS",
+            _jcfg._iter_opts.cpus(),
+            (iptr_type) + 1,
+        std::numeric_limits<iptr_type>::     max())
+
 
         #undef  __testINTS
         #undef  __testREAL
@@ -899,6 +1001,10 @@
             "TRIA-FILE", _tria_file)
         __dumpFILE(
             "BNDS-FILE", _bnds_file)
+        __dumpBOOL(
+            "FILE-BINS", _jcfg._file_bins)
+        __dumpFILE(
+            "STAT-FILE", _stat_file)
 
         _jlog.push("\n") ;
 
@@ -927,6 +1033,11 @@
         __dumpREAL("INIT-NEAR",
             _jcfg._mesh_opts.near())
 
+        __dumpBOOL("INIT-KEEP",
+            _jcfg._init_keep)
+        __dumpINTS("INIT-HALO",
+            _jcfg._init_halo)
+
         _jlog.push("\n") ;
 
     /*---------------------------- push HFUN keywords */
@@ -945,6 +1056,19 @@
         __dumpREAL(
             "HFUN-HMIN", _jcfg._hfun_hmin)
 
+        if(_jcfg._hfun_clip ==
+         jcfg_data::hfun_clip::marching)
+        _jlog.push (
+            "  HFUN-CLIP = MARCHING \n") ;
+        else
+        if(_jcfg._hfun_clip ==
+         jcfg_data::hfun_clip::sweeping)
+        _jlog.push (
+            "  HFUN-CLIP = SWEEPING \n") ;
+
+        __dumpINTS(
+            "HFUN-CPUS", _jcfg._hfun_cpus)
+
         _jlog.push("\n") ;
 
     /*---------------------------- push BNDS keywords */
@@ -985,6 +1109,9 @@
         __dumpINTS("MESH-DIMS",
             _jcfg._mesh_opts.dims())
 
+        __dumpINTS("MESH-CPUS",
+            _jcfg._mesh_opts.cpus())
+
         __dumpREAL("MESH-SIZ1",
             _jcfg._mesh_opts.siz1())
         __dumpREAL("MESH-SIZ2",
@@ -1050,6 +1177,9 @@
         __dumpBOOL("OPTM-DUAL",
             _jcfg._iter_opts.dual())
 
+        __dumpINTS("OPTM-CPUS",
+            _jcfg._iter_opts.cpus())
+
         _jlog.push("\n") ;
 
         }
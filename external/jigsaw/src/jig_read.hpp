@@ -72,6 +72,12 @@
     __normal_call void_type push_bnds_file (
         std::string  /*_file*/
         ) { }
+    __normal_call void_type push_file_bins (
+        bool         /*_flag*/
+        ) { }
+    __normal_call void_type push_stat_file (
+        std::string  /*_file*/
+        ) { }
 
     __normal_call void_type push_geom_seed (
         std::int32_t /*_seed*/
@@ -95,6 +101,12 @@
     __normal_call void_type push_init_near (
         double       /*_near*/
         ) { }
+    __normal_call void_type push_init_keep (
+        bool         /*_keep*/
+        ) { }
+    __normal_call void_type push_init_halo (
+        std::int32_t /*_halo*/
+        ) { }
 
     __normal_call void_type push_hfun_scal (
         std::int32_t /*_scal*/
@@ -105,6 +117,12 @@
     __normal_call void_type push_hfun_hmin (
         double       /*_hmin*/
         ) { }
+    __normal_call void_type push_hfun_clip (
+        std::int32_t /*_clip*/
+        ) { }
+    __normal_call void_type push_hfun_cpus (
+        std::int32_t /*_cpus*/
+        ) { }
 
     __normal_call void_type push_mesh_kern (
         std::int32_t /*_kern*/
@@ -115,6 +133,9 @@
     __normal_call void_type push_mesh_dims (
         std::int32_t /*_dims*/
         ) { }
+    __normal_call void_type push_mesh_cpus (
+        std::int32_t /*_cpus*/
+        ) { }
     __normal_call void_type push_mesh_iter (
         std::int32_t /*_iter*/
         ) { }
@@ -188,6 +209,9 @@
     __normal_call void_type push_optm_zip_ (
         bool         /*_flag*/
         ) { }
+    __normal_call void_type push_optm_cpus (
+        std::int32_t /*_cpus*/
+        ) { }
 
     } ;
 
@@ -328,6 +352,26 @@
             else                        \
            _errs.push_tail(_line) ;
 
+    /*---------------------------------- read "CLIP" pred */
+        #define __putCLIP(__fun, __str)     \
+            if (__str.count() == 2 )    \
+            {                           \
+                __toUPPER(__str [1])    \
+            if (__str[1].find("MARCHING")!= \
+                    std::string::npos ) \
+                _dest.__fun (           \
+                    jcfg_data::hfun_clip::marching) ;   \
+            else                        \
+            if (__str[1].find("SWEEPING")!= \
+                    std::string::npos ) \
+                _dest.__fun (           \
+                    jcfg_data::hfun_clip::sweeping) ;   \
+            else                        \
+           _errs.push_tail(_line) ;     \
+            }                           \
+            else                        \
+           _errs.push_tail(_line) ;
+
     /*---------------------------------- read "real" data */
         #define __putREAL(__fun, __tok)     \
             if (__tok.count() == +2)    \
@@ -447,6 +491,16 @@
             __putREAL(push_init_near, _stok) ;
                 }
             else
+            if (_stok[0] == "INIT_KEEP")
+                {
+            __putBOOL(push_init_keep, _stok) ;
+                }
+            else
+            if (_stok[0] == "INIT_HALO")
+                {
+            __putINTS(push_init_halo, _stok) ;
+                }
+            else
         /*---------------------------- read HFUN keywords */
             if (_stok[0] == "HFUN_FILE")
                 {
@@ -468,6 +522,16 @@
             __putREAL(push_hfun_hmin, _stok) ;
                 }
             else
+            if (_stok[0] == "HFUN_CLIP")
+                {
+            __putCLIP(push_hfun_clip, _stok) ;
+                }
+            else
+            if (_stok[0] == "HFUN_CPUS")
+                {
+            __putINTS(push_hfun_cpus, _stok) ;
+                }
+            else
         /*---------------------------- read MESH keywords */
             if (_stok[0] == "TRIA_FILE")
                 {
@@ -479,6 +543,16 @@
             __putFILE(push_bnds_file, _stok) ;
                 }
             else
+            if (_stok[0] == "FILE_BINS")
+                {
+            __putBOOL(push_file_bins, _stok) ;
+                }
+            else
+            if (_stok[0] == "STAT_FILE")
+                {
+            __putFILE(push_stat_file, _stok) ;
+                }
+            else
         /*---------------------------- read MESH keywords */
             if (_stok[0] == "MESH_FILE")
                 {
@@ -500,6 +574,11 @@
             __putINTS(push_mesh_dims, _stok) ;
                 }
             else
+            if (_stok[0] == "MESH_CPUS")
+                {
+            __putINTS(push_mesh_cpus, _stok) ;
+                }
+            else
             if (_stok[0] == "MESH_SIZ1")
                 {
             __putREAL(push_mesh_siz1, _stok) ;
@@ -619,6 +698,11 @@
                 {
             __putBOOL(push_optm_dual, _stok) ;
                 }
+            else
+            if (_stok[0] == "OPTM_CPUS")
+                {
+            __putINTS(push_optm_cpus, _stok) ;
+                }
 
             }
             catch (...)
@@ -632,6 +716,7 @@
 
         #undef  __putFILE
         #undef  __putSCAL
+        #undef  __putCLIP
         #undef  __putMESH
         #undef  __putOPTM
         #undef  __putBNDS
@@ -194,6 +194,9 @@
 #   endif
 #   if  defined(  USE_TIMERS)
 #       define  __use_timers
+#   endif
+#   if  defined(  USE_OPENMP)
+#       define  __use_openmp
 #   endif
 
     //  define  __cmd_jigsaw          // the cmd-ln exe's
@@ -232,6 +235,32 @@
 #   include <sstream>
 #   include <iostream>
 
+    /*---------------------------------- for binary files */
+
+#   include <cstring>
+#   include <cstdint>
+
+#   if defined(__unix__) || defined(__APPLE__)
+#   define  __use_mmap
+#   endif
+
+#   ifdef  __use_mmap
+#   include <fcntl.h>
+#   include <unistd.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   endif//__use_mmap
+
+    /*---------------------------------- for memory usage */
+
+#   if defined(__unix__) || defined(__APPLE__)
+#   define  __use_rusage
+#   endif
+
+#   ifdef  __use_rusage
+#   include <sys/resource.h>
+#   endif//__use_rusage
+
     /*---------------------------------- for ascii string */
 
 #   include <string>
@@ -248,6 +277,14 @@
 #   include <chrono>
 #   endif//__use_timers
 
+    /*---------------------------------- to do threading */
+
+#   include <exception>
+
+#   ifdef  __use_openmp
+#   include <omp.h>
+#   endif//__use_openmp
+
     /*---------------------------------- to do netcdf i/o */
 
     extern  "C"
@@ -333,6 +370,12 @@
         std::string             _tria_file ;
         std::string             _mesh_file ;
         std::string             _bnds_file ;
+        std::string             _stat_file ;
+
+        bool_type               _file_bins = false ;
+
+        bool_type               _init_keep = false ;
+        iptr_type               _init_halo = +2 ;
 
         iptr_type               _verbosity = 0 ;
 
@@ -390,6 +433,20 @@
         real_type _hfun_hmin =
             (real_type) +0.00E+00 ;
 
+    /*--------------------------------- H(x) |dh/dx| clip */
+        struct hfun_clip {
+            enum enum_data {
+            nullclip ,
+            marching = JIGSAW_HFUN_MARCHING,
+            sweeping = JIGSAW_HFUN_SWEEPING
+            } ;
+            } ;
+
+        hfun_clip::enum_data
+            _hfun_clip = hfun_clip::marching ;
+
+        iptr_type _hfun_cpus = +1 ;
+
     /*------------------------------- "low-level" config. */
         typedef mesh::mesh_params <
                 real_type ,
@@ -558,8 +615,6 @@
             jcfg_data &_jcfg
             )
         {
-            __unreferenced(_jcfg) ;
-
             this->
            _constant_value_kd.clip() ;
 
@@ -570,12 +625,28 @@
             this->
            _ellipsoid_mesh_3d.clip() ;
 
+            if (_jcfg._hfun_clip ==
+                jcfg_data::hfun_clip::sweeping)
+            {
+    /*------------------------- tiled sweeps, grids only! */
+            this->
+           _euclidean_grid_2d.
+                clip_sweep(_jcfg._hfun_cpus) ;
+            this->          // no R^3 limits: noted in log
+           _euclidean_grid_3d.clip() ;
+            this->
+           _ellipsoid_grid_3d.
+                clip_sweep(_jcfg._hfun_cpus) ;
+            }
+            else
+            {
             this->
            _euclidean_grid_2d.clip() ;
             this->
            _euclidean_grid_3d.clip() ;
             this->
            _ellipsoid_grid_3d.clip() ;
+            }
         }
 
         } ;
@@ -754,6 +825,56 @@
     #   include "hfn_init.hpp"
 
 
+    /*
+    --------------------------------------------------------
+     * PEAK-RSS: peak resident memory, in bytes.
+    --------------------------------------------------------
+     */
+
+    __inline_call std::size_t peak_rss (
+        )
+    {
+#   ifdef  __use_rusage
+        struct rusage _rusage ;
+        if (getrusage(RUSAGE_SELF, &_rusage) != +0)
+            return +0 ;
+
+#   ifdef  __APPLE__
+        return (std::size_t)_rusage.ru_maxrss ;
+#   else
+        return (std::size_t)_rusage.ru_maxrss * 1024 ;
+#   endif//__APPLE__
+
+#   else
+    /*---------------------------------- not supported... */
+        return +0 ;
+#   endif//__use_rusage
+    }
+
+    /*
+    --------------------------------------------------------
+     * CURR-RSS: current resident memory, in bytes.
+    --------------------------------------------------------
+     */
+
+    __inline_call std::size_t curr_rss (
+        )
+    {
+#   ifdef  __linux__
+        std::ifstream _file("/proc/self/statm") ;
+
+        std::size_t _size = +0, _rss_ = +0 ;
+        if (!(_file >> _size >> _rss_))
+            return +0 ;
+
+        return _rss_ *
+            (std::size_t)sysconf(_SC_PAGESIZE) ;
+#   else
+    /*---------------------------------- not supported... */
+        return +0 ;
+#   endif//__linux__
+    }
+
     /*
     --------------------------------------------------------
      * SAVE-MESH: push MESH data into file.
@@ -772,6 +893,15 @@
     #   include "msh_copy.hpp"
 
 
+    /*
+    --------------------------------------------------------
+     * INCR-MESH: re-mesh INIT data locally.
+    --------------------------------------------------------
+     */
+
+    #   include "msh_incr.hpp"
+
+
     /*
     --------------------------------------------------------
      * TIME-SPAN: elapsed sec. between markers.
@@ -826,6 +956,14 @@
 
 #   endif//__use_timers
 
+    /*
+    --------------------------------------------------------
+     * SAVE-STAT: push perf-stat data into file.
+    --------------------------------------------------------
+     */
+
+    #   include "stat_save.hpp"
+
     /*
     --------------------------------------------------------
      * Jumping-off points for CMD + LIB JIGSAW!
@@ -1029,6 +1029,282 @@
         return (  _errv ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     * Re-mesh an existing INIT mesh locally.
+    --------------------------------------------------------
+     */
+
+    // INIT cells that violate the current H(x) are grown
+    // by INIT_HALO rings of adj. cells, and this "cavity"
+    // is split into disjoint parts. Each part is re-meshed
+    // + optimised as a sub-problem, and spliced in if it
+    // passes. Cells outside of the parts are left as-is.
+    // If a part fails a check on its sub-mesh, it is grown
+    // by a ring into its neighbours and re-tried. DONE is
+    // FALSE if a full re-build is needed instead: the GEOM
+    // has changed, most cells are stale, any part is still
+    // failing once out of passes (so that no stale cells
+    // are kept), or the mesh type is not supported.
+
+    template <
+        typename  jlog_data
+             >
+    __normal_call iptr_type incr_core (
+        jcfg_data &_args,
+        jlog_data &_jlog,
+        geom_data &_geom,
+        hfun_data &_hfun,
+        mesh_data &_mesh,
+        bool_type &_done
+        )
+    {
+        iptr_type _errv = __no_error ;
+
+        iptr_type static constexpr _PASS = +3 ;
+
+        _done = false ;
+
+        try
+        {
+            if (_geom._ndim == +2 &&
+                _geom._kind ==
+                jmsh_kind::euclidean_mesh &&
+                _mesh._ndim == +2 &&
+                _mesh._kind ==
+                jmsh_kind::euclidean_mesh )
+            {
+        /*--------------- have euclidean-mesh GEOM kernel */
+            incr_data _incr ;
+
+            bool_type _kind = true ;
+
+            if (incr_geom(_args, _geom, _mesh, _incr))
+            {
+                _jlog.push (
+                "  **GEOM. has changed...\n\n") ;
+
+                _kind = false ;
+            }
+            else
+            if (_hfun._ndim == +0 )
+            {
+        /*--------------- with constant-value HFUN kernel */
+                incr_mark (
+                _hfun._constant_value_kd,
+                _mesh, _incr) ;
+            }
+            else
+            if (_hfun._ndim == +2 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_mesh)
+            {
+        /*--------------- with euclidean-mesh HFUN kernel */
+                incr_mark (
+                _hfun._euclidean_mesh_2d,
+                _mesh, _incr) ;
+            }
+            else
+            if (_hfun._ndim == +2 &&
+                _hfun._kind ==
+                jmsh_kind::euclidean_grid)
+            {
+        /*--------------- with euclidean-grid HFUN kernel */
+                incr_mark (
+                _hfun._euclidean_grid_2d,
+                _mesh, _incr) ;
+            }
+            else
+                _kind = false ;
+
+            if (_kind)
+            {
+            std::stringstream  _sstr ;
+            _sstr << "  STALE-TRIA = "
+                  << _incr._nbad << "\n" ;
+            _jlog.push(_sstr.str()) ;
+
+            if (_incr._nbad == +0) _done = true ;
+
+            iptr_type _pmax = _PASS ;
+
+            if (_incr._nbad * +2 >
+                (iptr_type)_incr._tmrk.count())
+            {
+        /*--------------- mostly stale: re-build instead */
+                _jlog.push (
+                "  **HFUN. has changed...\n\n") ;
+
+                _pmax = +0 ;
+            }
+
+        /*--------------- sub-problems run "quietly" */
+            jcfg_data _scfg = _args ;
+            _scfg._verbosity = +0 ;
+
+            _scfg._mesh_opts.feat() = false ;
+            _scfg._mesh_opts.seed() = +0 ;
+
+            jlog_null _slog(_scfg) ;
+
+            incr_halo(_mesh, _incr ,
+                      _args._init_halo) ;
+
+            incr_part(_mesh, _incr) ;
+
+            iptr_type _nprt = _pmax == +0 ? +0 :
+           (iptr_type)_incr._cptr.count() - 1 ;
+
+            iptr_type _nfix = +0, _nbad = +0 ;
+            iptr_type _ncav = +0, _npas = +0 ;
+
+            for (auto _ipos = +0 ;
+                      _ipos < _nprt; ++_ipos)
+            {
+        /*--------------- re-mesh each part on its own */
+            incr_next(_incr, _ipos) ;
+
+            bool_type _okay = false ;
+
+            for (auto _pass = +1 ;
+                !_okay && _pass <= _pmax; ++_pass)
+            {
+                geom_data _sgeo ;
+                mesh_data _sini , _smsh ;
+
+                if (_pass > +1)
+                    incr_halo(_mesh, _incr, +1) ;
+
+                if (!incr_cavs(_scfg, _geom, _mesh,
+                        _incr, _sgeo, _sini))
+                {
+        /*--------------- can't be fixed by growing it */
+                    _sstr.str("") ;
+                    _sstr << "  **CAVS " << _ipos + 1
+                          << ", PASS " << _pass
+                          << ": " << _incr._fail
+                          << "\n" ;
+                    _jlog.push(_sstr.str()) ;
+
+                    break ;
+                }
+
+                if ((_errv = mesh_core (
+                     _scfg, _slog ,
+                     _sgeo, _sini ,
+                     _hfun, _smsh)) != __no_error ||
+                    (_errv = copy_mesh (
+                     _scfg,
+                     _slog, _smsh)) != __no_error)
+                {
+        /*--------------- sub-problem failed: re-build all */
+                    _sstr.str("") ;
+                    _sstr << "  **CAVS " << _ipos + 1
+                          << ", PASS " << _pass
+                          << ": error " << _errv
+                          << "\n" ;
+                    _jlog.push(_sstr.str()) ;
+
+                    _errv = __no_error ;
+
+                    break ;
+                }
+
+                if (!incr_pick(_mesh, _sgeo, _smsh, _incr))
+                {
+        /*--------------- grow the cavity, and re-try */
+                    _sstr.str("") ;
+                    _sstr << "  **CAVS " << _ipos + 1
+                          << ", PASS " << _pass
+                          << ": " << _incr._fail
+                          << "\n" ;
+                    _jlog.push(_sstr.str()) ;
+
+                    continue ;
+                }
+
+                if ((_errv = init_mesh (
+                     _scfg, _slog ,
+                     _geom, _smsh)) != __no_error ||
+                    (_scfg._iter_opts.iter() != +0 &&
+                    (_errv = iter_core (
+                     _scfg, _slog ,
+                     _geom,
+                     _hfun, _smsh)) != __no_error))
+                {
+        /*--------------- sub-problem failed: re-build all */
+                    _sstr.str("") ;
+                    _sstr << "  **CAVS " << _ipos + 1
+                          << ", PASS " << _pass
+                          << ": error " << _errv
+                          << "\n" ;
+                    _jlog.push(_sstr.str()) ;
+
+                    _errv = __no_error ;
+
+                    break ;
+                }
+
+                _ncav += (iptr_type)
+                    _incr._tcav.count() ;
+                _npas  = std::max(_npas, _pass) ;
+
+                incr_push(_mesh, _smsh, _incr) ;
+
+                _okay = true ;
+            }
+
+            if (_okay)
+                _nfix += +1 ;
+            else
+            {
+                _nbad += +1 ;
+
+                break ;     // re-build anyway
+            }
+            }
+
+            if (_nprt >= +1)
+            {
+            _sstr.str("") ;
+            _sstr << "  CAVS-PART = "
+                  << _nprt << "\n"
+                  << "  CAVS-FAIL = "
+                  << _nbad << "\n"
+                  << "  CAVS-TRIA = "
+                  << _ncav << "\n"
+                  << "  CAVS-PASS = "
+                  << _npas << "\n" ;
+            _jlog.push(_sstr.str()) ;
+
+        /*--------------- any failed part: re-build all */
+            _done = _nbad == +0 ;
+            }
+
+            _jlog.push("\n") ;
+            }
+            }
+
+            if (!_done)
+            {
+        /*--------------- full re-build: drop INIT cells */
+                _jlog.push (
+                "  **Full re-build...\n\n") ;
+
+                _mesh._euclidean_mesh_2d._mesh.
+                    clear(containers::tight_alloc) ;
+                _mesh._euclidean_mesh_3d._mesh.
+                    clear(containers::tight_alloc) ;
+            }
+        }
+        catch (...)
+        {
+            _errv = __unknown_error ;
+        }
+
+        return (  _errv ) ;
+    }
+
     }
 
 #   ifdef __lib_jigsaw
@@ -1057,6 +1333,8 @@
         mesh_data _mesh ;               // MESH data
         jcfg_data _jcfg ;
 
+        bool_type _incr = false ;       // INIT re-meshed
+
 #       ifdef  __use_timers
         typename std ::chrono::
         high_resolution_clock::
@@ -1073,6 +1351,9 @@
     /*--------------------------------- init. geo. kernel */
         mp_float::exactinit() ;
 
+    /*--------------------------------- init. perf. stats */
+        reset_stat() ;
+
     /*--------------------------------- init. output data */
         jigsaw_init_msh_t(_mmsh) ;
 
@@ -1120,6 +1401,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-cfg-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1151,6 +1434,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-geom-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1185,6 +1470,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-geom-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1216,6 +1503,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-init-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1253,6 +1542,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-init-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1284,6 +1575,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-hfun-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1325,10 +1618,45 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-hfun-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
         if (_gmsh != nullptr )
+        {
+            if(_jcfg._mesh_opts.iter() != +0 &&
+               _jcfg._init_keep )
+            {
+    /*--------------------------------- call incr routine */
+            _jlog.push (  __jloglndv    "\n" ) ;
+            _jlog.push (
+                "  Update rDT MESH...\n\n" ) ;
+
+#           ifdef  __use_timers
+            _ttic   = _time.now();
+#           endif//__use_timers
+
+            if ((_retv =
+                JIGSAW ::incr_core (
+                 _jcfg, _jlog ,
+                 _geom, _hfun ,
+                 _mesh, _incr)) != __no_error)
+            {
+                return  _retv ;
+            }
+
+#           ifdef  __use_timers
+            _ttoc   = _time.now();
+            _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("update-rdt-mesh",
+                time_span(_ttic, _ttoc)) ;
+#           endif//__use_timers
+            }
+        }
+
+        if (_gmsh != nullptr &&
+            !_incr )
         {
             if(_jcfg._mesh_opts.iter() != +0 )
             {
@@ -1353,11 +1681,14 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("generate-rdt-mesh",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
             }
         }
 
-        if (_gmsh != nullptr )
+        if (_gmsh != nullptr &&
+            !_incr )
         {
     /*--------------------------------- call copy routine */
             _jlog.push (  __jloglndv    "\n" ) ;
@@ -1402,10 +1733,13 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-mesh-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
-        if (_gmsh != nullptr )
+        if (_gmsh != nullptr &&
+            !_incr )
         {
             if(_jcfg._iter_opts.iter() != +0 )
             {
@@ -1430,6 +1764,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("mesh-optimisation",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
             }
         }
@@ -1446,7 +1782,8 @@
 #           endif//__use_timers
 
             if (_jcfg._mesh_opts.iter() != +0 &&
-                _jcfg._iter_opts.iter() == +0 )
+                _jcfg._iter_opts.iter() == +0 &&
+               !_incr )
             {
 
             if ((_retv = save_rdel (
@@ -1472,6 +1809,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("writing-mesh-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1493,6 +1832,8 @@
         geom_data _geom ;               // GEOM data
         mesh_data _mesh ;               // MESH data
 
+        bool_type _incr = false ;       // INIT re-meshed
+
 #       ifdef  __use_timers
         typename std ::chrono::
         high_resolution_clock::
@@ -1509,6 +1850,9 @@
     /*--------------------------------- init. geo. kernel */
         mp_float::exactinit() ;
 
+    /*--------------------------------- init. perf. stats */
+        reset_stat() ;
+
     /*-------------------------- find *.JFCG file in args */
         iptr_type _retv = -1  ;
         jcfg_data _jcfg ;
@@ -1600,9 +1944,14 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-cfg-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
+    /*--------------------------------- init. perf. stats */
+        open_stat(_jcfg) ;
+
         if(!_jcfg._geom_file.empty())
         {
     /*--------------------------------- parse *.GEOM file */
@@ -1631,6 +1980,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-geom-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1665,6 +2016,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-geom-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1696,6 +2049,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-init-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1733,6 +2088,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-init-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1764,6 +2121,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-hfun-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -1805,10 +2164,45 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-hfun-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
         if(!_jcfg._geom_file.empty())
+        {
+            if(_jcfg._mesh_opts.iter() != +0 &&
+               _jcfg._init_keep )
+            {
+    /*--------------------------------- call incr routine */
+            _jlog.push (  __jloglndv    "\n" ) ;
+            _jlog.push (
+                "  Update rDT MESH...\n\n" ) ;
+
+#           ifdef  __use_timers
+            _ttic   = _time.now();
+#           endif//__use_timers
+
+            if ((_retv =
+                JIGSAW ::incr_core (
+                 _jcfg, _jlog ,
+                 _geom, _hfun ,
+                 _mesh, _incr)) != __no_error)
+            {
+                return  _retv ;
+            }
+
+#           ifdef  __use_timers
+            _ttoc   = _time.now();
+            _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("update-rdt-mesh",
+                time_span(_ttic, _ttoc)) ;
+#           endif//__use_timers
+            }
+        }
+
+        if(!_jcfg._geom_file.empty() &&
+           !_incr )
         {
             if(_jcfg._mesh_opts.iter() != +0 )
             {
@@ -1833,12 +2227,15 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("generate-rdt-mesh",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
             }
         }
 
         if(!_jcfg._geom_file.empty() &&
-           !_jcfg._tria_file.empty() )
+           !_jcfg._tria_file.empty() &&
+           !_incr )
         {
     /*--------------------------------- dump tria to file */
             _jlog.push (  __jloglndv    "\n" ) ;
@@ -1859,10 +2256,13 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("writing-tria-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
-        if(!_jcfg._geom_file.empty())
+        if(!_jcfg._geom_file.empty() &&
+           !_incr )
         {
     /*--------------------------------- call copy routine */
             _jlog.push (  __jloglndv    "\n" ) ;
@@ -1907,10 +2307,13 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-mesh-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
-        if(!_jcfg._geom_file.empty())
+        if(!_jcfg._geom_file.empty() &&
+           !_incr )
         {
             if(_jcfg._iter_opts.iter() != +0 )
             {
@@ -1935,6 +2338,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("mesh-optimisation",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
             }
         }
@@ -1952,7 +2357,8 @@
 #           endif//__use_timers
 
             if (_jcfg._mesh_opts.iter() != +0 &&
-                _jcfg._iter_opts.iter() == +0 )
+                _jcfg._iter_opts.iter() == +0 &&
+               !_incr )
             {
 
             if ((_retv = save_rdel (
@@ -1978,9 +2384,22 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("writing-mesh-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
+        if(!_jcfg._stat_file.empty())
+        {
+    /*--------------------------------- dump stat to file */
+            if ((_retv = save_stat (
+                 _jcfg,
+                 _jlog, "jigsaw")) != __no_error)
+            {
+                return  _retv ;
+            }
+        }
+
     /*-------------------------- success, if we got here! */
 
         return ( _retv ) ;
@@ -47,10 +47,12 @@
 #   define __ALLOCATORS__
 
 #   include "basebase.hpp"
+#   include "perfstat.hpp"
 
 #   include "allocators/alloc_base.hpp"
 #   include "allocators/alloc_pool.hpp"
 #   include "allocators/alloc_wrap.hpp"
+#   include "allocators/alloc_arena.hpp"
 
 #   include "allocators/alloc_item.hpp"
 
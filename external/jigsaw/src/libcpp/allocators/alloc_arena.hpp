@@ -0,0 +1,210 @@
+    /*
+    --------------------------------------------------------
+     * "arena" allocator -- bump alloc. from one block.
+    --------------------------------------------------------
+     *
+     * _ARENA-ALLOC hands out aligned sub-buffers from one
+     * contiguous block, reserved up front. Nothing is
+     * released individually: the whole block is freed on
+     * CLEAR. Intended for "bulk" data structures whose
+     * sizes are known before they are filled, so that
+     * storage is exact and allocation is just a bump of
+     * an offset.
+     *
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2013-2020
+     * Darren Engwirda
+     * d.engwirda@gmail.com
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __ALLOC_ARENA___
+#   define __ALLOC_ARENA___
+
+#   include "alloc_base.hpp"
+
+    namespace allocators {
+
+    template <
+    typename    A = basic_alloc
+             >
+    class  _arena_alloc : public A
+    {
+/*--- arena allocator: one block, bump-pointer sub-alloc. */
+    public  :
+
+    typedef A                           base_type ;
+
+    typedef typename
+            base_type::size_type        size_type ;
+
+    typedef _arena_alloc <A>            self_type ;
+
+    std::size_t static constexpr
+        align_size = alignof(std::max_align_t) ;
+
+    public  :
+
+    char_type                  *_head = nullptr ;
+    size_type                   _size = +0 ;
+    size_type                   _next = +0 ;
+
+    public  :
+
+    /*
+    --------------------------------------------------------
+     * ALIGN-SIZE: round a byte count to alignment.
+    --------------------------------------------------------
+     */
+
+    __static_call
+    __inline_call size_type aligned (
+        size_type _byte_size
+        )
+    {
+        return ((_byte_size + align_size - 1)
+                / align_size) * align_size ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * _ARENA-ALLOC: construct / destruct.
+    --------------------------------------------------------
+     */
+
+    __inline_call  _arena_alloc (
+        ) = default ;
+
+    __inline_call ~_arena_alloc (
+        )
+    {
+        clear () ;
+    }
+
+    __inline_call  _arena_alloc (
+        self_type const& _src
+        )                   = delete ;
+
+    __inline_call self_type& operator = (
+        self_type const& _src
+        )                   = delete ;
+
+    /*
+    --------------------------------------------------------
+     * RESERVE: alloc. one block for the arena.
+    --------------------------------------------------------
+     */
+
+    __inline_call void_type reserve (
+        size_type _byte_size
+        )
+    {
+        clear () ;
+
+        this->_size = aligned(_byte_size) ;
+        this->_head =
+            base_type::allocate(this->_size) ;
+        this->_next = +0 ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * ALLOCATE: take next aligned sub-buffer.
+    --------------------------------------------------------
+     */
+
+    template <
+    typename      data_type
+             >
+    __inline_call data_type* allocate (
+        size_type _new_count
+        )
+    {
+        size_type _byte_size = aligned(
+            _new_count * sizeof(data_type)) ;
+
+    /*------------------------------ throw on alloc fails */
+        if (this->_next +
+            _byte_size > this->_size)
+        throw std::bad_alloc ();
+
+        data_type *_addr = (data_type*)
+            (this->_head + this->_next) ;
+
+        this->_next += _byte_size ;
+
+        return ( _addr ) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * CLEAR: release the whole arena block.
+    --------------------------------------------------------
+     */
+
+    __inline_call void_type clear (
+        )
+    {
+        base_type::deallocate(
+            this->_head, this->_size) ;
+
+        this->_head = nullptr ;
+        this->_size = +0 ;
+        this->_next = +0 ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * BYTES: reserved size of the arena block.
+    --------------------------------------------------------
+     */
+
+    __inline_call size_type bytes (
+        ) const
+    {
+        return this->_size ;
+    }
+
+    } ;
+
+
+    }
+
+#   endif   //__ALLOC_ARENA__
+
+
+
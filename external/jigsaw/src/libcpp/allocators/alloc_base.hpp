@@ -57,6 +57,8 @@
 #   include <cstdlib>
 #   include <new>
 
+#   include "../perfstat.hpp"
+
     namespace allocators {
 
     class   basic_alloc
@@ -91,6 +93,9 @@
              nullptr == _addr )
         throw std::bad_alloc ();
 
+    /*------------------------------ track live/peak size */
+        perfstat::push_bytes(_new_count) ;
+
     /*------------------------------ return memory buffer */
         return ( _addr ) ;
     }
@@ -108,8 +113,6 @@
         size_type _new_count
         )
     {
-        __unreferenced(_old_count) ;
-
     /*---------------------- delegate to malloc & friends */
         char_type* _nptr =
        (char_type*)std::realloc(_addr,_new_count) ;
@@ -119,6 +122,10 @@
              nullptr == _nptr )
         throw std::bad_alloc ();
 
+    /*------------------------------ track live/peak size */
+        perfstat::_pop_bytes(_old_count) ;
+        perfstat::push_bytes(_new_count) ;
+
     /*------------------------------ return memory buffer */
         return ( _nptr ) ;
     }
@@ -135,11 +142,13 @@
         size_type _old_count
         )
     {
-        __unreferenced(_old_count);
-
     /*---------------------- delegate to malloc & friends */
         if (nullptr != _addr)
+        {
             std::free( _addr) ;
+
+            perfstat::_pop_bytes(_old_count) ;
+        }
     }
 
     } ;
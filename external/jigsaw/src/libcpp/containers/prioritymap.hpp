@@ -400,7 +400,9 @@
     __inline_call kptr_type push ( // copy
         data_type const&_data
         )
-    {/*---------------- make room for new item in mapping */
+    {
+        perfstat::bump(perfstat::QUEUE_PUSH) ;
+    /*---------------- make room for new item in mapping */
         kptr_type _kptr;
         if (this->_free.empty())
            _kptr = this->_keys.push_tail();
@@ -431,7 +433,9 @@
     __inline_call kptr_type push ( // move
         data_type && _data
         )
-    {/*---------------- make room for new item in mapping */
+    {
+        perfstat::bump(perfstat::QUEUE_PUSH) ;
+    /*---------------- make room for new item in mapping */
         kptr_type _kptr;
         if (this->_free.empty())
            _kptr = this->_keys.push_tail();
@@ -476,6 +480,7 @@
         data_type &_data
         )
     {
+        perfstat::bump(perfstat::QUEUE_POPS) ;
     /*---------------------------- _pop item, return data */
         size_type _hpos =   +0 ;
         kptr_type _kptr ;
@@ -525,6 +530,7 @@
         data_type &_data
         )
     {
+        perfstat::bump(perfstat::QUEUE_POPS) ;
     /*---------------------------- _pop item, return data */
         size_type _hpos = this->_keys[_kptr];
         _data =
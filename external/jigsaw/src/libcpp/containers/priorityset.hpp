@@ -333,6 +333,7 @@
         data_type const&_data
         )
     {
+        perfstat::bump(perfstat::QUEUE_PUSH) ;
     /*---------------- push data onto "tail" of container */
         size_type _tpos =
         this->_heap.push_tail() ;
@@ -350,6 +351,7 @@
         data_type &&_data
         )
     {
+        perfstat::bump(perfstat::QUEUE_PUSH) ;
     /*---------------- push data onto "tail" of container */
         size_type _tpos =
         this->_heap.push_tail() ;
@@ -397,6 +399,7 @@
         data_type &_data
         )
     {
+        perfstat::bump(perfstat::QUEUE_POPS) ;
     /*---------------------------- _pop data, return data */
         _data = std::move (
             *(this->_heap.head() + _hpos));
@@ -117,6 +117,11 @@
     typedef typename
         mesh_type::connector            conn_list ;
 
+    typedef mesh::mesh_compact_k <
+                real_type ,
+                iptr_type ,
+                geom_dims          >    comp_type ;
+
     public  :
 
     /*
@@ -927,6 +932,7 @@
     __static_call
     __normal_call void_type sort_node (
         mesh_type &_mesh ,
+        comp_type &_comp ,
         iptr_list &_nset ,
         iptr_list &_aset ,
         iptr_list &_nmrk ,
@@ -1134,8 +1140,7 @@
         {
         /*-------------------- push any 1-cell neighbours */
             _conn.set_count(0) ;
-            _mesh.connect_1(
-                &*_iter, POINT_tag, _conn);
+            _comp.connect_1(*_iter, _conn) ;
 
             for (auto _next  = _conn.head();
                       _next != _conn.tend();
@@ -1153,8 +1158,7 @@
 
         /*-------------------- push any 2-cell neighbours */
             _conn.set_count(0) ;
-            _mesh.connect_2(
-                &*_iter, POINT_tag, _conn);
+            _comp.connect_2(*_iter, _conn) ;
 
             for (auto _next  = _conn.head();
                       _next != _conn.tend();
@@ -1189,6 +1193,66 @@
     #   undef   PUSHCONN
     }
 
+    /*
+    --------------------------------------------------------
+     * MOVE-PARA: coloured, multi-threaded node passes.
+    --------------------------------------------------------
+     */
+
+    #include "iter_para_2.inc"
+
+    /*
+    --------------------------------------------------------
+     * FILL-HVAL: batch eval. H(x) over a cell stencil.
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  hbuf_type
+             >
+    __static_call
+    __normal_call void_type fill_hval (
+        mesh_type &_mesh ,
+        real_list &_hval ,
+        conn_list &_conn ,
+        hbuf_type &_hbuf
+        )
+    {
+    /*-------------------- queue nodes w/o a cached H(x), so
+     * that the lazy EVALHFUN calls in the stencil kernels
+     * just hit the cache.
+     */
+        for (auto _next  = _conn.head() ;
+                  _next != _conn.tend() ;
+                ++_next  )
+        {
+            iptr_type _node[4], _nnum ;
+            _nnum =
+            cell_node(_mesh, *_next, _node) ;
+
+            for (auto _inod = +0;
+                _inod != _nnum; ++_inod)
+            {
+                iptr_type _npos = _node[_inod] ;
+
+                if (_hval[_npos] < (real_type)+0.)
+                {
+                    auto _nptr =
+                   _mesh.node().head() + _npos;
+
+                    _hval[_npos] =  // queued
+                        (real_type)+0. ;
+
+                    _hbuf.push(
+                   &_nptr->pval(0), _nptr->hidx(),
+                    _hval[_npos]) ;
+                }
+            }
+        }
+
+        _hbuf.flush() ;
+    }
+
     /*
     --------------------------------------------------------
      * MOVE-NODE: do a single node smoothing pass.
@@ -1199,6 +1263,7 @@
     __normal_call void_type move_node (
         geom_type &_geom ,
         mesh_type &_mesh ,
+        comp_type &_comp ,
         hfun_type &_hfun ,
         char_type  _kern ,
         real_list &_hval ,
@@ -1209,7 +1274,8 @@
         iptr_type  _isub ,
         iter_opts &_opts ,
         iptr_type &_nmov ,
-        real_type  _QLIM
+        real_type  _QLIM ,
+        real_type &_busy
         )
     {
     #   define MARK(_NODE) _mark._node[_NODE]
@@ -1219,15 +1285,29 @@
         real_list _qold, _qnew, _dold, _dnew;
 
     /*-------------------- permute nodes for optimisation */
-        sort_node(_mesh, _nset, _aset,
+        sort_node(_mesh, _comp, _nset, _aset,
             _mark._node, _amrk, _iout, _isub,
             _opts) ;
 
         _nmov = (iptr_type) +0;
 
+    /*-------------------- COLOURED iteration on CELL */
+        if (_opts .tria() &&
+            _opts .cpus() > +1)
+        {
+            move_para( _geom, _mesh, _comp,
+                _hfun, _kern, _hval,
+                _aset, _nset, _mark,
+                _iout, _opts, _nmov,
+                _QLIM, _busy, cell_kind()) ;
+        }
+        else
     /*-------------------- GAUSS-SEIDEL iteration on CELL */
         if (_opts .tria())
         {
+        hfun_query_k <hfun_type,
+            pred_type::geom_dims> _hbuf(_hfun) ;
+
         for (auto _apos  = _aset.head() ;
                   _apos != _aset.tend() ;
                 ++_apos  )
@@ -1237,13 +1317,14 @@
 
         /*---------------- assemble a local tria. stencil */
             _conn.set_count( +0) ;
-            _mesh.connect_2(
-                &*_apos, POINT_tag, _conn);
+            _comp.connect_2(*_apos, _conn) ;
 
             if (_conn.empty()) continue ;
 
             if (_mark._node[*_apos] >= +0)
             {
+            fill_hval(_mesh, _hval, _conn, _hbuf) ;
+
         /*---------------- attempt to optimise CELL geom. */
             _qold.set_count( +0) ;
             _qnew.set_count( +0) ;
@@ -1299,6 +1380,7 @@
     __normal_call void_type move_dual (
         geom_type &_geom ,
         mesh_type &_mesh ,
+        comp_type &_comp ,
         hfun_type &_hfun ,
         real_list &_hval ,
         iptr_list &_nset ,
@@ -1308,7 +1390,8 @@
         iptr_type  _isub ,
         iter_opts &_opts ,
         iptr_type &_nmov ,
-        real_type  _DLIM
+        real_type  _DLIM ,
+        real_type &_busy
         )
     {
     #   define MARK(_NODE) _mark._node[_NODE]
@@ -1318,12 +1401,23 @@
         real_list _qold, _qnew, _dold, _dnew;
 
     /*-------------------- permute nodes for optimisation */
-        sort_node(_mesh, _nset, _aset,
+        sort_node(_mesh, _comp, _nset, _aset,
             _mark._node, _amrk, _iout, _isub,
             _opts) ;
 
         _nmov = (iptr_type) +0;
 
+    /*-------------------- COLOURED iteration on DUAL */
+        if (_opts .dual() &&
+            _opts .cpus() > +1)
+        {
+            move_para( _geom, _mesh, _comp,
+                _hfun, +0   , _hval,
+                _aset, _nset, _mark,
+                _iout, _opts, _nmov,
+                _DLIM, _busy, dual_kind()) ;
+        }
+        else
     /*-------------------- GAUSS-SEIDEL iteration on DUAL */
         if (_opts .dual())
         {
@@ -1336,8 +1430,7 @@
 
         /*---------------- assemble a local tria. stencil */
             _conn.set_count( +0) ;
-            _mesh.connect_2(
-                &*_apos, POINT_tag, _conn);
+            _comp.connect_2(*_apos, _conn) ;
 
             if (_conn.empty()) continue ;
 
@@ -1816,6 +1909,8 @@
         typename std ::chrono::
         high_resolution_clock::time_point _ttoc;
         typename std ::chrono::
+        high_resolution_clock::time_point _titr;
+        typename std ::chrono::
         high_resolution_clock _time;
 
         __unreferenced(_time) ; // why does MSVC need this??
@@ -1944,6 +2039,10 @@
         for (auto _iter = +1 ;
             _iter <= _opts.iter(); ++_iter)
         {
+    #       ifdef  __use_timers
+            _titr = _time.now() ;
+    #       endif//__use_timers
+
     /*------------------------------ set-up current iter. */
             init_mark(_mesh, _mark,
                 std::max(_iter-1, +0)) ;
@@ -1960,11 +2059,15 @@
 
             _nset.set_count(  +0);
 
+            comp_type _comp;
+
             iptr_type _nmov = +0 ;
             iptr_type _nflp = +0 ;
             iptr_type _nzip = +0 ;
             iptr_type _ndiv = +0 ;
 
+            real_type _busy = +0.;
+
     /*------------------------------ scale quality thresh */
             iptr_type _nsub = _iter +0 ;
 
@@ -1993,6 +2096,8 @@
             _ttic = _time.now() ;
     #       endif//__use_timers
 
+            mesh::make_compact(_mesh, _comp, true) ;
+
             for (auto _isub = + 0 ;
                 _isub != _nsub/1; ++_isub )
             {
@@ -2002,10 +2107,12 @@
 
                 iptr_type  _nloc;
                 move_node( _geom, _mesh ,
+                    _comp,
                     _hfun, _kern, _hval ,
                     _nset, _amrk, _mark ,
                     _iter, _isub,
-                    _opts, _nloc, _QLIM ) ;
+                    _opts, _nloc, _QLIM ,
+                    _busy) ;
 
                 _nmov = std::max (_nmov ,
                                   _nloc ) ;
@@ -2015,6 +2122,9 @@
             _ttoc = _time.now() ;
             _tcpu._move_node +=
                 _tcpu.time_span(_ttic, _ttoc);
+            _tcpu._node_busy += _opts.cpus() > 1 ?
+                _busy :
+                _tcpu.time_span(_ttic, _ttoc);
     #       endif//__use_timers
 
     /*------------------------------ update mesh topology */
@@ -2054,6 +2164,10 @@
 
             _amrk.fill( -1 );
 
+            _busy = (real_type) +0. ;
+
+            mesh::make_compact(_mesh, _comp, true) ;
+
             for (auto _isub = + 0 ;
                 _isub != _nsub/2; ++_isub )
             {
@@ -2063,10 +2177,12 @@
 
                 iptr_type  _nloc;
                 move_dual( _geom, _mesh ,
+                    _comp,
                     _hfun, _hval,
                     _nset, _amrk, _mark ,
                     _iter, _isub,
-                    _opts, _nloc, _DLIM ) ;
+                    _opts, _nloc, _DLIM ,
+                    _busy) ;
 
                 _nmov = std::max (_nmov ,
                                   _nloc ) ;
@@ -2076,6 +2192,9 @@
             _ttoc = _time.now() ;
             _tcpu._move_dual +=
                 _tcpu.time_span(_ttic, _ttoc);
+            _tcpu._dual_busy += _opts.cpus() > 1 ?
+                _busy :
+                _tcpu.time_span(_ttic, _ttoc);
     #       endif//__use_timers
 
     /*------------------------------ update mesh topology */
@@ -2159,6 +2278,19 @@
                 _tcpu.time_span(_ttic, _ttoc);
     #       endif//__use_timers
 
+    /*------------------------------ push iter. perf-stat */
+            perfstat::iter_data _stat ;
+    #       ifdef  __use_timers
+            _stat._time =
+                _tcpu.time_span(_titr, _time.now()) ;
+    #       endif//__use_timers
+            _stat._nmov = _nmov ;
+            _stat._nflp = _nflp ;
+            _stat._nzip = _nzip ;
+            _stat._ndiv = _ndiv ;
+
+            perfstat::push_iter(_stat) ;
+
     /*------------------------------ dump optim. progress */
             if (_opts.verb() >= 0)
             {
@@ -2208,6 +2340,36 @@
             _dump.push("\n");
 
             _dump.push("\n");
+
+            if (_opts.cpus() > +1)
+            {
+    /*------------------------------ print para. metrics */
+            iptr_type _nthr = _opts.cpus() ;
+
+            _dump.push("**PARALLEL efficiency: ") ;
+            _dump.push("\n");
+
+            _dump.push("  MOVE-NODE: ");
+            _dump.push(
+                _tcpu.para_str(_tcpu._node_busy,
+                    _tcpu._move_node, _nthr));
+            _dump.push("\n");
+
+            _dump.push("  MOVE-DUAL: ");
+            _dump.push(
+                _tcpu.para_str(_tcpu._dual_busy,
+                    _tcpu._move_dual, _nthr));
+            _dump.push("\n");
+
+    /*------------------------------ flip/zip: serial ops */
+            _dump.push("  TOPO-FLIP: serial") ;
+            _dump.push("\n");
+
+            _dump.push("  TOPO-ZIPS: serial") ;
+            _dump.push("\n");
+
+            _dump.push("\n");
+            }
         }
         else
         {
@@ -74,6 +74,9 @@
         real_type   _topo_flip = (real_type)  +0. ;
         real_type   _topo_zips = (real_type)  +0. ;
 
+        real_type   _node_busy = (real_type)  +0. ;
+        real_type   _dual_busy = (real_type)  +0. ;
+
         public  :
 
     /*-------------------------------------- elapsed time */
@@ -97,6 +100,37 @@
 
     #   endif//__use_timers
 
+    /*-------------------------------------- para. effic. */
+
+        __inline_call real_type para_eff (
+            real_type _busy ,
+            real_type _wall ,
+            iptr_type _nthr
+            )
+        {
+            if (_wall <= (real_type) +0.)
+                return (real_type) -1. ;
+
+            return _busy / (_wall * _nthr) ;
+        }
+
+    /*-------------------------------------- para. label. */
+
+        __inline_call std::string para_str (
+            real_type _busy ,
+            real_type _wall ,
+            iptr_type _nthr
+            )
+        {
+            real_type _peff =
+                para_eff(_busy, _wall, _nthr) ;
+
+            if (_peff < (real_type) +0.)
+                return std::string("n/a") ;
+
+            return std::to_string(_peff) ;
+        }
+
         } ;
 
     }
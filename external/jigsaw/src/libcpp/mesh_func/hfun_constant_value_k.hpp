@@ -83,12 +83,35 @@
         hint_type &_hint
         )
     {
+        perfstat::bump(perfstat::HFUN_EVAL) ;
+
         __unreferenced(_ppos) ;
         __unreferenced(_hint) ;
 
         return  this-> _hval  ;
     }
 
+    /*--------------------------- batch: fill all values */
+
+    __normal_call void_type eval (
+        iptr_type  _pnum,
+        real_type *_ppos,
+        hint_type *_hint,
+        real_type *_hval
+        )
+    {
+        perfstat::bump(
+            perfstat::HFUN_EVAL, _pnum) ;
+
+        __unreferenced(_ppos) ;
+        __unreferenced(_hint) ;
+
+        for (auto _ipos = _pnum; _ipos-- != 0; )
+        {
+            _hval[_ipos] = this->_hval ;
+        }
+    }
+
     } ;
 
 
@@ -721,6 +721,177 @@
 
     }
 
+    /*
+    --------------------------------------------------------
+     * CLIP-SWEEP: impose |dh/dx| limits, via sweeping.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type clip_sweep (
+        iptr_type _cpus
+        )
+    {
+        class cell_pred
+        {
+    /*-------------------- clip one cell, TRUE on change */
+        public  :
+            hfun_grid_ellipsoid_3d *_hfun ;
+
+            real_list                  _xcos ;
+            real_list                  _xsin ;
+            real_list                  _ycos ;
+            real_list                  _ysin ;
+
+        public  :
+        __inline_call cell_pred  (
+            hfun_grid_ellipsoid_3d *_hsrc
+            ) : _hfun(_hsrc)
+        {
+    /*-------------------- cache trig. terms for S^2 to R^3 */
+            for (auto _iter  =
+                _hfun->_xpos.head() ;
+                      _iter !=
+                _hfun->_xpos.tend() ;
+                    ++_iter  )
+            {
+                _xcos.push_tail(std::cos(*_iter));
+                _xsin.push_tail(std::sin(*_iter));
+            }
+
+            for (auto _iter  =
+                _hfun->_ypos.head() ;
+                      _iter !=
+                _hfun->_ypos.tend() ;
+                    ++_iter  )
+            {
+                _ycos.push_tail(std::cos(*_iter));
+                _ysin.push_tail(std::sin(*_iter));
+            }
+        }
+
+        __inline_call void_type toR3 (
+            iptr_type _ipos,
+            iptr_type _jpos,
+            real_type*_ppos
+            ) const
+        {
+            _ppos[0] =  _hfun->_radA *
+                _xcos[_jpos] * _ycos[_ipos] ;
+            _ppos[1] =  _hfun->_radB *
+                _xsin[_jpos] * _ycos[_ipos] ;
+            _ppos[2] =  _hfun->_radC *
+                _ysin[_ipos] ;
+        }
+
+        __inline_call
+            bool_type operator() (
+            iptr_type _ipos,
+            iptr_type _jpos
+            )
+        {
+            iptr_type  _inod, _jnod ,
+                       _knod, _lnod ;
+            _hfun->indx_from_subs(
+                _ipos + 0, _jpos + 0, _inod) ;
+            _hfun->indx_from_subs(
+                _ipos + 1, _jpos + 0, _jnod) ;
+            _hfun->indx_from_subs(
+                _ipos + 1, _jpos + 1, _knod) ;
+            _hfun->indx_from_subs(
+                _ipos + 0, _jpos + 1, _lnod) ;
+
+            real_type _IXYZ[3];
+            toR3(_ipos + 0, _jpos + 0, _IXYZ) ;
+
+            real_type _JXYZ[3];
+            toR3(_ipos + 1, _jpos + 0, _JXYZ) ;
+
+            real_type _KXYZ[3];
+            toR3(_ipos + 1, _jpos + 1, _KXYZ) ;
+
+            real_type _LXYZ[3];
+            toR3(_ipos + 0, _jpos + 1, _LXYZ) ;
+
+            real_type _iold = _hfun->_hmat[_inod] ;
+            real_type _jold = _hfun->_hmat[_jnod] ;
+            real_type _kold = _hfun->_hmat[_knod] ;
+            real_type _lold = _hfun->_hmat[_lnod] ;
+
+            bool_type _gvar =
+                _hfun->_dhdx.count() > 1 ;
+
+            eikonal_quad_3d (
+               _IXYZ , _JXYZ ,
+               _KXYZ , _LXYZ ,
+                _hfun->_hmat[_inod],
+                _hfun->_hmat[_jnod],
+                _hfun->_hmat[_knod],
+                _hfun->_hmat[_lnod],
+                _hfun->_dhdx[_gvar ? _inod : 0],
+                _hfun->_dhdx[_gvar ? _jnod : 0],
+                _hfun->_dhdx[_gvar ? _knod : 0],
+                _hfun->_dhdx[_gvar ? _lnod : 0]) ;
+
+            return _hfun->_hmat[_inod] < _iold ||
+                   _hfun->_hmat[_jnod] < _jold ||
+                   _hfun->_hmat[_knod] < _kold ||
+                   _hfun->_hmat[_lnod] < _lold ;
+        }
+        } ;
+
+        class pair_pred
+        {
+    /*-------------------- min. over periodic nodes in row */
+        public  :
+            hfun_grid_ellipsoid_3d *_hfun ;
+
+        public  :
+        __inline_call pair_pred  (
+            hfun_grid_ellipsoid_3d *_hsrc
+            ) : _hfun(_hsrc) {}
+
+        __inline_call
+            bool_type operator() (
+            iptr_type _ipos
+            )
+        {
+            iptr_type  _left, _pair ;
+            _hfun->indx_from_subs(_ipos, +0 ,
+                _left) ;
+            _hfun->indx_from_subs(_ipos,
+           (iptr_type)_hfun->_xpos.count()-1,
+                _pair) ;
+
+            real_type _hmin = std::min(
+                _hfun->_hmat[_left],
+                _hfun->_hmat[_pair]) ;
+
+            if (_hfun->_hmat[_left] == _hmin &&
+                _hfun->_hmat[_pair] == _hmin)
+                return false ;
+
+            _hfun->_hmat[_left] = _hmin ;
+            _hfun->_hmat[_pair] = _hmin ;
+
+            return  true ;
+        }
+        } ;
+
+        if (this->_dhdx.empty()) return ;
+
+        if (this->_xpos.count() < 2) return ;
+        if (this->_ypos.count() < 2) return ;
+
+    /*-------------------- compute h(x) via tiled sweeps */
+        cell_pred _cell(this) ;
+        pair_pred _pair(this) ;
+
+        sweep_tile_2d(
+       (iptr_type)this->_ypos.count() - 1 ,
+       (iptr_type)this->_xpos.count() - 1 ,
+            _cpus, this->_wrap, _cell, _pair) ;
+    }
+
     /*
     --------------------------------------------------------
      * EVAL: eval. size-fun. value.
@@ -732,6 +903,8 @@
         hint_type &_hint
         )
     {
+        perfstat::bump(perfstat::HFUN_EVAL) ;
+
         real_type static const FT =
             std::pow (
         +std::numeric_limits <real_type>
@@ -945,6 +1118,296 @@
         else { return _hbar ; } // return interior interp
     }
 
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. in batch.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type eval (
+        iptr_type  _pnum,
+        real_type *_ppos,   // PNUM x 3, row-major
+        hint_type *_hint,
+        real_type *_hval
+        )
+    {
+        perfstat::bump(
+            perfstat::HFUN_EVAL, _pnum) ;
+
+    /*---------------------------- cache-blocked "SoA" eval
+     * of PNUM points, matching the scalar EVAL bitwise.
+     * Points are mapped to lon-lat one-by-one, with cell
+     * look-ups on uniform axes and the bilinear interp.
+     * then done as unit-stride loops over the block.
+     */
+        real_type static const FT =
+            std::pow (
+        +std::numeric_limits <real_type>
+            ::epsilon(),(real_type)+.8);
+
+        real_type static const PI =
+       (real_type)std::atan(+1.0) * +4.;
+
+        real_type static const PI_h =
+       (real_type)+.5 * PI ;
+        real_type static const PI_1 =
+       (real_type)+1. * PI ;
+        real_type static const PI_2 =
+       (real_type)+2. * PI ;
+
+        iptr_type static constexpr
+            _BLOCK = (iptr_type) +64;
+
+        __unreferenced (_hint) ;
+
+        if (this->_xpos.count() == +0 ||
+            this->_ypos.count() == +0 )
+        {
+            for (auto _ipos = _pnum;
+                      _ipos-- != 0; )
+            {
+                _hval[_ipos] =
+            +std::numeric_limits
+                <real_type>::infinity() ;
+            }
+            return ;
+        }
+
+        bool_type _unit =
+            this->_radA == +1. &&
+            this->_radB == +1. &&
+            this->_radC == +1. ;
+
+        iptr_type _xnum =
+            (iptr_type)this->_xpos.count() ;
+        iptr_type _ynum =
+            (iptr_type)this->_ypos.count() ;
+
+        real_type _xmin, _xmax, _xdel;
+        _xmin = *this->_xpos.head();
+        _xmax = *this->_xpos.tail();
+        _xdel = (_xmax - _xmin) / (_xnum - 1) ;
+
+        real_type _ymin, _ymax, _ydel;
+        _ymin = *this->_ypos.head();
+        _ymax = *this->_ypos.tail();
+        _ydel = (_ymax - _ymin) / (_ynum - 1) ;
+
+        real_type const *_xptr =
+            &this->_xpos[0] ;
+        real_type const *_yptr =
+            &this->_ypos[0] ;
+        real_type const *_hptr =
+            &this->_hmat[0] ;
+
+        iptr_type _ilst = (iptr_type)-1 ;
+        iptr_type _jlst = (iptr_type)-1 ;
+
+        real_type _XPOS[_BLOCK], _YPOS[_BLOCK];
+        iptr_type _IPOS[_BLOCK], _JPOS[_BLOCK];
+
+        iptr_type _POLE[_BLOCK];
+        real_type _BIAS[_BLOCK];
+
+        for (iptr_type _ibeg = +0 ;
+                _ibeg < _pnum; _ibeg += _BLOCK)
+        {
+            iptr_type _bnum = std::min(
+                _pnum - _ibeg, _BLOCK) ;
+
+            real_type *_pblk =
+                &_ppos[_ibeg * 3] ;
+            real_type *_hblk =
+                &_hval[_ibeg * 1] ;
+
+    /*---------------------------- compute xyz to lat-lon */
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                real_type *_pval =
+                    &_pblk[_item * 3] ;
+
+                real_type _apos[2] ;
+                if (_unit)
+                {
+                real_type _radius = std::sqrt (
+                    _pval[0]*_pval[0] +
+                    _pval[1]*_pval[1] +
+                    _pval[2]*_pval[2] ) ;
+
+                if (_radius < FT)
+                _radius  = _radius + FT ;
+
+                _apos[1] =
+                std::asin (_pval[2]/ _radius ) ;
+
+                _apos[0] =
+                std::atan2(_pval[1], _pval[0]) ;
+                }
+                else
+                {
+                    toS2(_pval, _apos);
+                }
+
+                real_type _alon = _apos[ 0] ;
+                real_type _alat = _apos[ 1] ;
+
+                iptr_type _pole = (iptr_type)0 ;
+                real_type _bias = (real_type)0.;
+
+                if (_alon<-PI_1) _alon += PI_2 ;
+                if (_alon>=PI_1) _alon -= PI_2 ;
+
+                if (_alon < _xmin) _alon = _xmin;
+                if (_alon > _xmax) _alon = _xmax;
+
+                if (_alat<-PI_h) _alat  =-PI_h ;
+                if (_alat>=PI_h) _alat  = PI_h ;
+
+                if (_alat < _ymin)
+                {
+                    _bias =     // deal w interp. at pole
+                   (_alat - _ymin) / (-PI_h - _ymin) ;
+                    _pole = -1 ;
+                    _alat = _ymin;
+
+                    _bias = std::sin(_bias*PI_h) ;
+                }
+
+                if (_alat > _ymax)
+                {
+                    _bias =     // deal w interp. at pole
+                   (_alat - _ymax) / (+PI_h - _ymax) ;
+                    _pole = +1 ;
+                    _alat = _ymax;
+
+                    _bias = std::sin(_bias*PI_h) ;
+                }
+
+                _XPOS[_item] = _alon ;
+                _YPOS[_item] = _alat ;
+                _POLE[_item] = _pole ;
+                _BIAS[_item] = _bias ;
+            }
+
+    /*---------------------------- find enclosing x-range */
+            if (this->_xvar == true)
+            {
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _JPOS[_item] = _jlst =
+                    grid_walk(_xptr, _xnum,
+                        _XPOS[_item], _jlst) ;
+            }
+            }
+            else
+            {
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _JPOS[_item] = (iptr_type)
+                 ((_XPOS[_item] - _xmin) / _xdel);
+            }
+            }
+
+    /*---------------------------- find enclosing y-range */
+            if (this->_yvar == true)
+            {
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _IPOS[_item] = _ilst =
+                    grid_walk(_yptr, _ynum,
+                        _YPOS[_item], _ilst) ;
+            }
+            }
+            else
+            {
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _IPOS[_item] = (iptr_type)
+                 ((_YPOS[_item] - _ymin) / _ydel);
+            }
+            }
+
+    /*---------------------------- a linear interpolation */
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                iptr_type _ipos = _IPOS[_item] ;
+                iptr_type _jpos = _JPOS[_item] ;
+
+                _ipos = _ipos == _ynum - 1 ?
+                        _ipos - 1 : _ipos ;
+                _jpos = _jpos == _xnum - 1 ?
+                        _jpos - 1 : _jpos ;
+
+                real_type _xval = _XPOS[_item] ;
+                real_type _yval = _YPOS[_item] ;
+
+                real_type _xp11 = _xptr[_jpos+0] ;
+                real_type _xp22 = _xptr[_jpos+1] ;
+                real_type _yp11 = _yptr[_ipos+0] ;
+                real_type _yp22 = _yptr[_ipos+1] ;
+
+                real_type _aa22 =
+                   (_yval-_yp11) * (_xval-_xp11) ;
+                real_type _aa21 =
+                   (_yval-_yp11) * (_xp22-_xval) ;
+                real_type _aa12 =
+                   (_yp22-_yval) * (_xval-_xp11) ;
+                real_type _aa11 =
+                   (_yp22-_yval) * (_xp22-_xval) ;
+
+                iptr_type _kk11 =
+                   (_jpos+0) * _ynum + (_ipos+0) ;
+                iptr_type _kk12 =
+                   (_jpos+1) * _ynum + (_ipos+0) ;
+                iptr_type _kk21 =
+                   (_jpos+0) * _ynum + (_ipos+1) ;
+                iptr_type _kk22 =
+                   (_jpos+1) * _ynum + (_ipos+1) ;
+
+                _hblk[_item] =
+                  ( _aa11*_hptr[_kk11]
+                  + _aa12*_hptr[_kk12]
+                  + _aa21*_hptr[_kk21]
+                  + _aa22*_hptr[_kk22] )
+                / ( _aa11+_aa12+_aa21+_aa22) ;
+            }
+
+    /*---------------------------- deal w interp. at pole */
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                if (_POLE[_item] >= +1)
+                {
+                _hblk[_item] =
+        ((real_type)1. - _BIAS[_item]) * _hblk[_item] +
+        ((real_type)0. + _BIAS[_item]) * this->_htop ;
+                }
+                else
+                if (_POLE[_item] <= -1)
+                {
+                _hblk[_item] =
+        ((real_type)1. - _BIAS[_item]) * _hblk[_item] +
+        ((real_type)0. + _BIAS[_item]) * this->_hbot ;
+                }
+            }
+        }
+    }
+
     } ;
 
 
@@ -382,6 +382,114 @@
 
     }
 
+    /*
+    --------------------------------------------------------
+     * CLIP-SWEEP: impose |dh/dx| limits, via sweeping.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type clip_sweep (
+        iptr_type _cpus
+        )
+    {
+        class cell_pred
+        {
+    /*-------------------- clip one cell, TRUE on change */
+        public  :
+            hfun_grid_euclidean_2d *_hfun ;
+
+        public  :
+        __inline_call cell_pred  (
+            hfun_grid_euclidean_2d *_hsrc
+            ) : _hfun(_hsrc) {}
+
+        __inline_call
+            bool_type operator() (
+            iptr_type _ipos,
+            iptr_type _jpos
+            )
+        {
+            iptr_type  _inod, _jnod ,
+                       _knod, _lnod ;
+            _hfun->indx_from_subs(
+                _ipos + 0, _jpos + 0, _inod) ;
+            _hfun->indx_from_subs(
+                _ipos + 1, _jpos + 0, _jnod) ;
+            _hfun->indx_from_subs(
+                _ipos + 1, _jpos + 1, _knod) ;
+            _hfun->indx_from_subs(
+                _ipos + 0, _jpos + 1, _lnod) ;
+
+            real_type _IXYZ[2];
+            _IXYZ[0] = _hfun->_xpos[_jpos+0];
+            _IXYZ[1] = _hfun->_ypos[_ipos+0];
+
+            real_type _JXYZ[2];
+            _JXYZ[0] = _hfun->_xpos[_jpos+0];
+            _JXYZ[1] = _hfun->_ypos[_ipos+1];
+
+            real_type _KXYZ[2];
+            _KXYZ[0] = _hfun->_xpos[_jpos+1];
+            _KXYZ[1] = _hfun->_ypos[_ipos+1];
+
+            real_type _LXYZ[2];
+            _LXYZ[0] = _hfun->_xpos[_jpos+1];
+            _LXYZ[1] = _hfun->_ypos[_ipos+0];
+
+            real_type _iold = _hfun->_hmat[_inod] ;
+            real_type _jold = _hfun->_hmat[_jnod] ;
+            real_type _kold = _hfun->_hmat[_knod] ;
+            real_type _lold = _hfun->_hmat[_lnod] ;
+
+            bool_type _gvar =
+                _hfun->_dhdx.count() > 1 ;
+
+            eikonal_quad_2d (
+               _IXYZ , _JXYZ ,
+               _KXYZ , _LXYZ ,
+                _hfun->_hmat[_inod],
+                _hfun->_hmat[_jnod],
+                _hfun->_hmat[_knod],
+                _hfun->_hmat[_lnod],
+                _hfun->_dhdx[_gvar ? _inod : 0],
+                _hfun->_dhdx[_gvar ? _jnod : 0],
+                _hfun->_dhdx[_gvar ? _knod : 0],
+                _hfun->_dhdx[_gvar ? _lnod : 0]) ;
+
+            return _hfun->_hmat[_inod] < _iold ||
+                   _hfun->_hmat[_jnod] < _jold ||
+                   _hfun->_hmat[_knod] < _kold ||
+                   _hfun->_hmat[_lnod] < _lold ;
+        }
+        } ;
+
+        class pair_pred
+        {
+    /*-------------------- no periodic bc's for R^2 grids */
+        public  :
+        __inline_call
+            bool_type operator() (
+            iptr_type /*_ipos*/
+            )
+        {   return  false ;
+        }
+        } ;
+
+        if (this->_dhdx.empty()) return ;
+
+        if (this->_xpos.count() < 2) return ;
+        if (this->_ypos.count() < 2) return ;
+
+    /*-------------------- compute h(x) via tiled sweeps */
+        cell_pred _cell(this) ;
+        pair_pred _pair ;
+
+        sweep_tile_2d(
+       (iptr_type)this->_ypos.count() - 1 ,
+       (iptr_type)this->_xpos.count() - 1 ,
+            _cpus, false, _cell, _pair) ;
+    }
+
     /*
     --------------------------------------------------------
      * INIT: init. size-fun. class.
@@ -462,6 +570,8 @@
         hint_type &_hint
         )
     {
+        perfstat::bump(perfstat::HFUN_EVAL) ;
+
         real_type _hOUT =
     +std::numeric_limits<real_type>::infinity();
 
@@ -589,6 +699,207 @@
         return (  _hBAR ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. in batch.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type eval (
+        iptr_type  _pnum,
+        real_type *_ppos,   // PNUM x 2, row-major
+        hint_type *_hint,
+        real_type *_hval
+        )
+    {
+        perfstat::bump(
+            perfstat::HFUN_EVAL, _pnum) ;
+
+    /*---------------------------- cache-blocked "SoA" eval
+     * of PNUM points, matching the scalar EVAL bitwise.
+     * Cell look-ups on uniform axes, and the bilinear
+     * interp., are simple unit-stride loops over a small
+     * block of points, such that they can vectorise.
+     */
+        iptr_type static constexpr
+            _BLOCK = (iptr_type) +64;
+
+        __unreferenced (_hint) ;
+
+        if (this->_xpos.count() == +0 ||
+            this->_ypos.count() == +0 )
+        {
+            for (auto _ipos = _pnum;
+                      _ipos-- != 0; )
+            {
+                _hval[_ipos] =
+            +std::numeric_limits
+                <real_type>::infinity() ;
+            }
+            return ;
+        }
+
+        iptr_type _xnum =
+            (iptr_type)this->_xpos.count() ;
+        iptr_type _ynum =
+            (iptr_type)this->_ypos.count() ;
+
+        real_type _xmin, _xmax, _xdel;
+        _xmin = *this->_xpos.head();
+        _xmax = *this->_xpos.tail();
+        _xdel = (_xmax - _xmin) / (_xnum - 1) ;
+
+        real_type _ymin, _ymax, _ydel;
+        _ymin = *this->_ypos.head();
+        _ymax = *this->_ypos.tail();
+        _ydel = (_ymax - _ymin) / (_ynum - 1) ;
+
+        real_type const *_xptr =
+            &this->_xpos[0] ;
+        real_type const *_yptr =
+            &this->_ypos[0] ;
+        real_type const *_hptr =
+            &this->_hmat[0] ;
+
+        iptr_type _ilst = (iptr_type)-1 ;
+        iptr_type _jlst = (iptr_type)-1 ;
+
+        real_type _XPOS[_BLOCK], _YPOS[_BLOCK];
+        iptr_type _IPOS[_BLOCK], _JPOS[_BLOCK];
+
+        for (iptr_type _ibeg = +0 ;
+                _ibeg < _pnum; _ibeg += _BLOCK)
+        {
+            iptr_type _bnum = std::min(
+                _pnum - _ibeg, _BLOCK) ;
+
+            real_type *_pblk =
+                &_ppos[_ibeg * 2] ;
+            real_type *_hblk =
+                &_hval[_ibeg * 1] ;
+
+    /*---------------------------- clamp to grid extents */
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                real_type _xval =
+                    _pblk[_item * 2 + 0] ;
+                real_type _yval =
+                    _pblk[_item * 2 + 1] ;
+
+                _xval = _xval < _xmin ?
+                        _xmin : _xval ;
+                _xval = _xval > _xmax ?
+                        _xmax : _xval ;
+
+                _yval = _yval < _ymin ?
+                        _ymin : _yval ;
+                _yval = _yval > _ymax ?
+                        _ymax : _yval ;
+
+                _XPOS[_item] = _xval ;
+                _YPOS[_item] = _yval ;
+            }
+
+    /*---------------------------- find enclosing x-range */
+            if (this->_xvar == true)
+            {
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _JPOS[_item] = _jlst =
+                    grid_walk(_xptr, _xnum,
+                        _XPOS[_item], _jlst) ;
+            }
+            }
+            else
+            {
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _JPOS[_item] = (iptr_type)
+                 ((_XPOS[_item] - _xmin) / _xdel);
+            }
+            }
+
+    /*---------------------------- find enclosing y-range */
+            if (this->_yvar == true)
+            {
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _IPOS[_item] = _ilst =
+                    grid_walk(_yptr, _ynum,
+                        _YPOS[_item], _ilst) ;
+            }
+            }
+            else
+            {
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _IPOS[_item] = (iptr_type)
+                 ((_YPOS[_item] - _ymin) / _ydel);
+            }
+            }
+
+    /*---------------------------- a linear interpolation */
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                iptr_type _ipos = _IPOS[_item] ;
+                iptr_type _jpos = _JPOS[_item] ;
+
+                _ipos = _ipos == _ynum - 1 ?
+                        _ipos - 1 : _ipos ;
+                _jpos = _jpos == _xnum - 1 ?
+                        _jpos - 1 : _jpos ;
+
+                real_type _XVAL = _XPOS[_item] ;
+                real_type _YVAL = _YPOS[_item] ;
+
+                real_type _xx11 = _xptr[_jpos+0] ;
+                real_type _xx22 = _xptr[_jpos+1] ;
+                real_type _yy11 = _yptr[_ipos+0] ;
+                real_type _yy22 = _yptr[_ipos+1] ;
+
+                real_type _aa22 =
+                   (_YVAL-_yy11) * (_XVAL-_xx11) ;
+                real_type _aa21 =
+                   (_YVAL-_yy11) * (_xx22-_XVAL) ;
+                real_type _aa12 =
+                   (_yy22-_YVAL) * (_XVAL-_xx11) ;
+                real_type _aa11 =
+                   (_yy22-_YVAL) * (_xx22-_XVAL) ;
+
+                iptr_type _kk11 =
+                   (_jpos+0) * _ynum + (_ipos+0) ;
+                iptr_type _kk12 =
+                   (_jpos+1) * _ynum + (_ipos+0) ;
+                iptr_type _kk21 =
+                   (_jpos+0) * _ynum + (_ipos+1) ;
+                iptr_type _kk22 =
+                   (_jpos+1) * _ynum + (_ipos+1) ;
+
+                _hblk[_item] =
+                  ( _aa11*_hptr[_kk11]
+                  + _aa12*_hptr[_kk12]
+                  + _aa21*_hptr[_kk21]
+                  + _aa22*_hptr[_kk22] )
+                / ( _aa11+_aa12+_aa21+_aa22) ;
+            }
+        }
+    }
+
     } ;
 
 
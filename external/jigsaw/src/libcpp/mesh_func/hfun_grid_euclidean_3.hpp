@@ -216,6 +216,8 @@
         hint_type &_hint
         )
     {
+        perfstat::bump(perfstat::HFUN_EVAL) ;
+
         real_type _hOUT =
     +std::numeric_limits<real_type>::infinity();
 
@@ -413,6 +415,283 @@
     }
 
 
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. in batch.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type eval (
+        iptr_type  _pnum,
+        real_type *_ppos,   // PNUM x 3, row-major
+        hint_type *_hint,
+        real_type *_hval
+        )
+    {
+        perfstat::bump(
+            perfstat::HFUN_EVAL, _pnum) ;
+
+    /*---------------------------- cache-blocked "SoA" eval
+     * of PNUM points, matching the scalar EVAL bitwise.
+     * Cell look-ups on uniform axes, and the trilinear
+     * interp., are simple unit-stride loops over a small
+     * block of points, such that they can vectorise.
+     */
+        iptr_type static constexpr
+            _BLOCK = (iptr_type) +64;
+
+        __unreferenced (_hint) ;
+
+        if (this->_xpos.count() == +0 ||
+            this->_ypos.count() == +0 ||
+            this->_zpos.count() == +0 )
+        {
+            for (auto _ipos = _pnum;
+                      _ipos-- != 0; )
+            {
+                _hval[_ipos] =
+            +std::numeric_limits
+                <real_type>::infinity() ;
+            }
+            return ;
+        }
+
+        iptr_type _xnum =
+            (iptr_type)this->_xpos.count() ;
+        iptr_type _ynum =
+            (iptr_type)this->_ypos.count() ;
+        iptr_type _znum =
+            (iptr_type)this->_zpos.count() ;
+
+        real_type _xmin, _xmax, _xdel;
+        _xmin = *this->_xpos.head();
+        _xmax = *this->_xpos.tail();
+        _xdel = (_xmax - _xmin) / (_xnum - 1) ;
+
+        real_type _ymin, _ymax, _ydel;
+        _ymin = *this->_ypos.head();
+        _ymax = *this->_ypos.tail();
+        _ydel = (_ymax - _ymin) / (_ynum - 1) ;
+
+        real_type _zmin, _zmax, _zdel;
+        _zmin = *this->_zpos.head();
+        _zmax = *this->_zpos.tail();
+        _zdel = (_zmax - _zmin) / (_znum - 1) ;
+
+        real_type const *_xptr =
+            &this->_xpos[0] ;
+        real_type const *_yptr =
+            &this->_ypos[0] ;
+        real_type const *_zptr =
+            &this->_zpos[0] ;
+        real_type const *_hptr =
+            &this->_hmat[0] ;
+
+        iptr_type _ilst = (iptr_type)-1 ;
+        iptr_type _jlst = (iptr_type)-1 ;
+        iptr_type _klst = (iptr_type)-1 ;
+
+        real_type _XPOS[_BLOCK], _YPOS[_BLOCK],
+                  _ZPOS[_BLOCK];
+        iptr_type _IPOS[_BLOCK], _JPOS[_BLOCK],
+                  _KPOS[_BLOCK];
+
+        for (iptr_type _ibeg = +0 ;
+                _ibeg < _pnum; _ibeg += _BLOCK)
+        {
+            iptr_type _bnum = std::min(
+                _pnum - _ibeg, _BLOCK) ;
+
+            real_type *_pblk =
+                &_ppos[_ibeg * 3] ;
+            real_type *_hblk =
+                &_hval[_ibeg * 1] ;
+
+    /*---------------------------- clamp to grid extents */
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                real_type _xval =
+                    _pblk[_item * 3 + 0] ;
+                real_type _yval =
+                    _pblk[_item * 3 + 1] ;
+                real_type _zval =
+                    _pblk[_item * 3 + 2] ;
+
+                _xval = _xval < _xmin ?
+                        _xmin : _xval ;
+                _xval = _xval > _xmax ?
+                        _xmax : _xval ;
+
+                _yval = _yval < _ymin ?
+                        _ymin : _yval ;
+                _yval = _yval > _ymax ?
+                        _ymax : _yval ;
+
+                _zval = _zval < _zmin ?
+                        _zmin : _zval ;
+                _zval = _zval > _zmax ?
+                        _zmax : _zval ;
+
+                _XPOS[_item] = _xval ;
+                _YPOS[_item] = _yval ;
+                _ZPOS[_item] = _zval ;
+            }
+
+    /*---------------------------- find enclosing x-range */
+            if (this->_xvar == true)
+            {
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _JPOS[_item] = _jlst =
+                    grid_walk(_xptr, _xnum,
+                        _XPOS[_item], _jlst) ;
+            }
+            }
+            else
+            {
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _JPOS[_item] = (iptr_type)
+                 ((_XPOS[_item] - _xmin) / _xdel);
+            }
+            }
+
+    /*---------------------------- find enclosing y-range */
+            if (this->_yvar == true)
+            {
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _IPOS[_item] = _ilst =
+                    grid_walk(_yptr, _ynum,
+                        _YPOS[_item], _ilst) ;
+            }
+            }
+            else
+            {
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _IPOS[_item] = (iptr_type)
+                 ((_YPOS[_item] - _ymin) / _ydel);
+            }
+            }
+
+    /*---------------------------- find enclosing z-range */
+            if (this->_zvar == true)
+            {
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _KPOS[_item] = _klst =
+                    grid_walk(_zptr, _znum,
+                        _ZPOS[_item], _klst) ;
+            }
+            }
+            else
+            {
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                _KPOS[_item] = (iptr_type)
+                 ((_ZPOS[_item] - _zmin) / _zdel);
+            }
+            }
+
+    /*---------------------------- a linear interpolation */
+#           ifdef   __use_openmp
+#           pragma omp simd
+#           endif//__use_openmp
+            for (iptr_type _item = +0 ;
+                    _item < _bnum; ++_item)
+            {
+                iptr_type _ipos = _IPOS[_item] ;
+                iptr_type _jpos = _JPOS[_item] ;
+                iptr_type _kpos = _KPOS[_item] ;
+
+                _ipos = _ipos == _ynum - 1 ?
+                        _ipos - 1 : _ipos ;
+                _jpos = _jpos == _xnum - 1 ?
+                        _jpos - 1 : _jpos ;
+                _kpos = _kpos == _znum - 1 ?
+                        _kpos - 1 : _kpos ;
+
+                real_type _XVAL = _XPOS[_item] ;
+                real_type _YVAL = _YPOS[_item] ;
+                real_type _ZVAL = _ZPOS[_item] ;
+
+                real_type _xx11 = _xptr[_jpos+0] ;
+                real_type _xx22 = _xptr[_jpos+1] ;
+                real_type _yy11 = _yptr[_ipos+0] ;
+                real_type _yy22 = _yptr[_ipos+1] ;
+                real_type _zz11 = _zptr[_kpos+0] ;
+                real_type _zz22 = _zptr[_kpos+1] ;
+
+                real_type _v222 =(_ZVAL-_zz11) *
+                   (_YVAL-_yy11)*(_XVAL-_xx11) ;
+                real_type _v212 =(_ZVAL-_zz11) *
+                   (_YVAL-_yy11)*(_xx22-_XVAL) ;
+                real_type _v122 =(_ZVAL-_zz11) *
+                   (_yy22-_YVAL)*(_XVAL-_xx11) ;
+                real_type _v112 =(_ZVAL-_zz11) *
+                   (_yy22-_YVAL)*(_xx22-_XVAL) ;
+
+                real_type _v221 =(_zz22-_ZVAL) *
+                   (_YVAL-_yy11)*(_XVAL-_xx11) ;
+                real_type _v211 =(_zz22-_ZVAL) *
+                   (_YVAL-_yy11)*(_xx22-_XVAL) ;
+                real_type _v121 =(_zz22-_ZVAL) *
+                   (_yy22-_YVAL)*(_XVAL-_xx11) ;
+                real_type _v111 =(_zz22-_ZVAL) *
+                   (_yy22-_YVAL)*(_xx22-_XVAL) ;
+
+                iptr_type _kmul = _xnum * _ynum ;
+
+                iptr_type _k111 = (_kpos+0) * _kmul
+                    + (_jpos+0) * _ynum + (_ipos+0) ;
+                iptr_type _k211 = (_kpos+0) * _kmul
+                    + (_jpos+0) * _ynum + (_ipos+1) ;
+                iptr_type _k121 = (_kpos+0) * _kmul
+                    + (_jpos+1) * _ynum + (_ipos+0) ;
+                iptr_type _k221 = (_kpos+0) * _kmul
+                    + (_jpos+1) * _ynum + (_ipos+1) ;
+
+                iptr_type _k112 = (_kpos+1) * _kmul
+                    + (_jpos+0) * _ynum + (_ipos+0) ;
+                iptr_type _k212 = (_kpos+1) * _kmul
+                    + (_jpos+0) * _ynum + (_ipos+1) ;
+                iptr_type _k122 = (_kpos+1) * _kmul
+                    + (_jpos+1) * _ynum + (_ipos+0) ;
+                iptr_type _k222 = (_kpos+1) * _kmul
+                    + (_jpos+1) * _ynum + (_ipos+1) ;
+
+                _hblk[_item] =
+                  ( _v111*_hptr[_k111]
+                  + _v112*_hptr[_k112]
+                  + _v121*_hptr[_k121]
+                  + _v211*_hptr[_k211]
+                  + _v122*_hptr[_k122]
+                  + _v212*_hptr[_k212]
+                  + _v221*_hptr[_k221]
+                  + _v222*_hptr[_k222] )
+                / ( _v111+_v112+_v121+_v211+
+                    _v122+_v212+_v221+_v222) ;
+            }
+        }
+    }
+
     } ;
 
 
@@ -705,13 +705,14 @@
 
     /*
     --------------------------------------------------------
-     * EVAL: eval. size-fun. value.
+     * EVAL-NEAR: eval. size-fun., given a local hint.
     --------------------------------------------------------
      */
 
-    __normal_call real_type eval (
+    __normal_call real_type eval_near (
         real_type *_ppos ,
-        hint_type &_hint
+        hint_type &_hint ,
+        hint_type  _hlst
         )
     /*------------------------ find tria + linear interp. */
     {
@@ -744,6 +745,18 @@
             _hint =  this->null_hint();
         }
 
+        if (_hint == this->null_hint() &&
+                hint_okay(_hlst))
+        {
+    /*------------------------ try hint from a neighbour */
+            if (near_pred( _ppos,
+                    _QPOS, _mesh,
+                    _hlst)  )
+            {
+            _hint =  _hlst ;
+            }
+        }
+
         if (_hint == this->null_hint())
         {
     /*------------------------ outside: find nearest tria */
@@ -799,6 +812,56 @@
         return  _hOUT ;
     }
 
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. value.
+    --------------------------------------------------------
+     */
+
+    __inline_call real_type eval (
+        real_type *_ppos ,
+        hint_type &_hint
+        )
+    {
+        perfstat::bump(perfstat::HFUN_EVAL) ;
+
+        return eval_near(_ppos, _hint,
+            this->null_hint()) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. in batch.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type eval (
+        iptr_type  _pnum ,
+        real_type *_ppos ,  // PNUM x 3, row-major
+        hint_type *_hint ,
+        real_type *_hval
+        )
+    {
+        perfstat::bump(
+            perfstat::HFUN_EVAL, _pnum) ;
+
+    /*------------------------ walk the batch in order, so
+     * that each point can fall back on the tria. found
+     * for its predecessor before searching the tree.
+     */
+        hint_type _hlst = this->null_hint() ;
+
+        for (iptr_type _ipos = +0 ;
+                _ipos < _pnum; ++_ipos)
+        {
+            _hval[_ipos] = eval_near (
+               &_ppos[_ipos * 3],
+                _hint[_ipos], _hlst) ;
+
+            _hlst = _hint[_ipos] ;
+        }
+    }
+
     } ;
 
 
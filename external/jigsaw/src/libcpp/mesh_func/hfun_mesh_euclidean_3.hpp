@@ -76,6 +76,10 @@
             real_type ,
             allocator >             real_list ;
 
+    typedef containers::array   <
+            iptr_type ,
+            allocator >             iptr_list ;
+
 
     typedef mesh_complex_node_3<I, R>
                                     node_type ;
@@ -130,6 +134,8 @@
     containers::array<
         real_type, allocator >     _dhdx ;
 
+    iptr_list                      _tadj ;
+
     public  :
 
     /*
@@ -223,6 +229,121 @@
                    this->_mesh.tri4(),
                    this->_tree,_BTOL ,
                   _NBOX , tria_pred()) ;
+
+    /*-------------------- make cell-to-cell adj. for walk */
+        make_adjs() ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * MAKE-ADJS: form cell-to-cell adj. for walks.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type make_adjs (
+        )
+    {
+    /*-------------------- form node-to-cell adj. as CSR */
+        iptr_type _nnod = (iptr_type)
+            this->_mesh.node().count() ;
+        iptr_type _ncel = (iptr_type)
+            this->_mesh.tri4().count() ;
+
+        iptr_list _nptr, _nnow, _cell ;
+        _nptr.set_count(_nnod + 1,
+            containers::tight_alloc, +0) ;
+        _nnow.set_count(_nnod + 0,
+            containers::tight_alloc, +0) ;
+
+        for (auto _tpos = +0 ;
+                  _tpos < _ncel; ++_tpos)
+        {
+            if (this->_mesh.
+                tri4(_tpos).mark() < +0) continue ;
+
+            for (auto _inum = 4; _inum-- != 0; )
+            {
+                _nptr[this->_mesh.tri4(
+                    _tpos).node(_inum) + 1] += 1 ;
+            }
+        }
+
+        for (auto _npos = +0 ;
+                  _npos < _nnod; ++_npos)
+        {
+            _nptr[_npos + 1] += _nptr[_npos] ;
+        }
+
+        _cell.set_count(_nptr[_nnod],
+            containers::tight_alloc) ;
+
+        for (auto _tpos = +0 ;
+                  _tpos < _ncel; ++_tpos)
+        {
+            if (this->_mesh.
+                tri4(_tpos).mark() < +0) continue ;
+
+            for (auto _inum = 4; _inum-- != 0; )
+            {
+                iptr_type _npos = this->_mesh.
+                    tri4(_tpos).node(_inum) ;
+
+                _cell[_nptr[_npos] +
+                      _nnow[_npos]++] = _tpos ;
+            }
+        }
+
+    /*-------------------- match faces about 1st face node */
+        this->_tadj.set_count(_ncel * 4,
+            containers::tight_alloc, -1) ;
+
+        for (auto _tpos = +0 ;
+                  _tpos < _ncel; ++_tpos)
+        {
+            if (this->_mesh.
+                tri4(_tpos).mark() < +0) continue ;
+
+            for (auto _fpos = 4; _fpos-- != 0; )
+            {
+                iptr_type  _fnod [4] ;
+                tri4_type::
+                face_node(_fnod, _fpos, 3, 2) ;
+
+                iptr_type  _inod = this->_mesh.
+                    tri4(_tpos).node(_fnod[0]) ;
+                iptr_type  _jnod = this->_mesh.
+                    tri4(_tpos).node(_fnod[1]) ;
+                iptr_type  _knod = this->_mesh.
+                    tri4(_tpos).node(_fnod[2]) ;
+
+                for (auto _kpos = _nptr[_inod] ;
+                          _kpos < _nptr[_inod+1] ;
+                        ++_kpos )
+                {
+                    iptr_type _tadj = _cell[_kpos] ;
+
+                    if (_tadj == _tpos) continue ;
+
+                    iptr_type _same = +0 ;
+                    for (auto _inum = 4; _inum-- != 0; )
+                    {
+                    iptr_type _node = this->_mesh.
+                        tri4(_tadj).node(_inum) ;
+
+                    if (_node == _jnod ||
+                        _node == _knod)
+                        _same += +1 ;
+                    }
+
+                    if (_same == +2)
+                    {
+                        this->_tadj[
+                        _tpos * 4 + _fpos] = _tadj ;
+                        break ;
+                    }
+                }
+            }
+        }
     }
 
     /*
@@ -672,13 +793,96 @@
 
     /*
     --------------------------------------------------------
-     * EVAL: eval. size-fun. value.
+     * WALK-TRIA: walk toward QPOS from a hint cell.
+    --------------------------------------------------------
+     */
+
+    __normal_call hint_type walk_tria (
+        real_type *_qpos ,
+        hint_type  _tpos
+        )
+    {
+    /*------------------------ step across the face with the
+     * most -ve barycentric weight until QPOS is enclosed.
+     * Returns NULL on leaving the mesh, or after MAXSTEP
+     * steps, leaving far jumps to the aabb-tree search.
+     */
+        iptr_type static constexpr
+            _MAXSTEP = (iptr_type) +32 ;
+
+        if (this->_tadj.count() !=
+            this->_mesh.tri4().count() * 4)
+            return this->null_hint() ;
+
+        for (auto _step = +0 ;
+                  _step < _MAXSTEP; ++_step)
+        {
+        real_type _tvol[4] ;
+        real_type _vsum = (real_type)+.0 ;
+
+        for(auto _fpos = 4; _fpos-- != 0; )
+        {
+            iptr_type  _fnod [4] ;
+            tri4_type::
+            face_node(_fnod, _fpos, 3, 2) ;
+
+            _fnod[0] = this->_mesh.
+             tri4(_tpos).node(_fnod[0]);
+            _fnod[1] = this->_mesh.
+             tri4(_tpos).node(_fnod[1]);
+            _fnod[2] = this->_mesh.
+             tri4(_tpos).node(_fnod[2]);
+
+            real_type _fvol =
+                geometry::tetra_vol_3d (
+               &this->_mesh.
+                node(_fnod[0]).pval(0) ,
+               &this->_mesh.
+                node(_fnod[1]).pval(0) ,
+               &this->_mesh.
+                node(_fnod[2]).pval(0) ,
+                _qpos) ;
+            _tvol[_fpos] = _fvol ;
+            _vsum       += _fvol ;
+        }
+
+        iptr_type _fout = -1 ;
+        real_type _vmin = (real_type)+.0 ;
+
+        for(auto _fpos = 4; _fpos-- != 0; )
+        {
+            real_type _vrel =
+                _vsum >= (real_type)+0. ?
+               +_tvol[_fpos] : -_tvol[_fpos] ;
+
+            if (_vrel < _vmin)
+            {
+                _vmin = _vrel; _fout = _fpos;
+            }
+        }
+
+    /*------------------------ QPOS is enclosed: all +ve */
+        if (_fout < +0) return _tpos ;
+
+        _tpos = this->_tadj[_tpos * 4 + _fout] ;
+
+    /*------------------------ walked off mesh boundary! */
+        if (_tpos < +0) return this->null_hint() ;
+        }
+
+        return this->null_hint() ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * EVAL-NEAR: eval. size-fun., given a local hint.
     --------------------------------------------------------
      */
 
-    __normal_call real_type eval (
+    __normal_call real_type eval_near (
         real_type *_ppos ,
-        hint_type &_hint
+        hint_type &_hint ,
+        hint_type  _hlst
         )
     /*------------------------ find tria + linear interp. */
     {
@@ -695,6 +899,8 @@
         real_type _hOUT =
     +std::numeric_limits<real_type>::infinity() ;
 
+        hint_type _hwlk = this->null_hint() ;
+
         if (hint_okay(_hint))
         {
     /*------------------------ test whether hint is valid */
@@ -702,6 +908,7 @@
                     _QPOS, _mesh,
                     _hint)  )
             {
+            _hwlk =  _hint ;
             _hint =  this->null_hint();
             }
         }
@@ -711,6 +918,20 @@
             _hint =  this->null_hint();
         }
 
+        if (_hint == this->null_hint() &&
+                hint_okay(_hlst))
+        {
+    /*------------------------ prefer hint from neighbour */
+            _hwlk =  _hlst ;
+        }
+
+        if (_hint == this->null_hint() &&
+            _hwlk != this->null_hint())
+        {
+    /*------------------------ walk to the tria. at QPOS */
+            _hint =  walk_tria(_QPOS, _hwlk) ;
+        }
+
         if (_hint == this->null_hint())
         {
     /*------------------------ scan to find bounding tria */
@@ -785,6 +1006,56 @@
         return  _hOUT ;
     }
 
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. value.
+    --------------------------------------------------------
+     */
+
+    __inline_call real_type eval (
+        real_type *_ppos ,
+        hint_type &_hint
+        )
+    {
+        perfstat::bump(perfstat::HFUN_EVAL) ;
+
+        return eval_near(_ppos, _hint,
+            this->null_hint()) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * EVAL: eval. size-fun. in batch.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type eval (
+        iptr_type  _pnum ,
+        real_type *_ppos ,  // PNUM x 3, row-major
+        hint_type *_hint ,
+        real_type *_hval
+        )
+    {
+        perfstat::bump(
+            perfstat::HFUN_EVAL, _pnum) ;
+
+    /*------------------------ walk the batch in order, so
+     * that each point can walk from the tria. found for
+     * its predecessor before searching the tree.
+     */
+        hint_type _hlst = this->null_hint() ;
+
+        for (iptr_type _ipos = +0 ;
+                _ipos < _pnum; ++_ipos)
+        {
+            _hval[_ipos] = eval_near (
+               &_ppos[_ipos * 3],
+                _hint[_ipos], _hlst) ;
+
+            _hlst = _hint[_ipos] ;
+        }
+    }
+
     } ;
 
 
@@ -0,0 +1,234 @@
+
+    /*
+    --------------------------------------------------------
+     * HFUN-QUERY-kD: batched queries for size-fun. H(x).
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2013-2020
+     * Darren Engwirda
+     * d.engwirda@gmail.com
+     * https://github.com/dengwirda
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __HFUN_QUERY_K__
+#   define __HFUN_QUERY_K__
+
+    namespace mesh {
+
+    /*
+    --------------------------------------------------------
+     * GRID-WALK: find enclosing cell on a var. grid axis.
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  iptr_type ,
+        typename  real_type
+             >
+    __inline_call iptr_type grid_walk (
+      __const_ptr(real_type) _xpos ,
+        iptr_type  _xnum ,
+        real_type  _XPOS ,
+        iptr_type  _jpos
+        )
+    {
+    /*------------ walk from the previous cell, and return
+     * the same index as UPPER-BOUND - 1: the last grid
+     * coord. <= XPOS. Queries arrive in spatially local
+     * batches, so only a few steps are typically needed,
+     * falling back to bisection for "far" jumps.
+     */
+        iptr_type static constexpr
+            _MAXSTEP = (iptr_type) +8 ;
+
+        if (_jpos >= +0 && _jpos < _xnum)
+        {
+        iptr_type _step = +0 ;
+        for ( ; _step < _MAXSTEP; ++_step)
+        {
+            if (_jpos + 1 < _xnum &&
+               !(_XPOS < _xpos[_jpos + 1]))
+            {
+                _jpos += +1 ;
+            }
+            else
+            if (_jpos - 0 >= +0 &&
+                (_XPOS < _xpos[_jpos + 0]))
+            {
+                _jpos -= +1 ;
+            }
+            else return ( _jpos ) ;
+        }
+        }
+
+        auto _joff =
+        algorithms::upper_bound (
+            _xpos, _xpos + _xnum,
+        _XPOS, std::less<real_type>()) ;
+
+        return (iptr_type)(_joff - _xpos - 1) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * HFUN-QUERY-K: buffered batch queries for H(x).
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  hfun_type ,
+        size_t    NDIM ,
+        size_t    SIZE = +64
+             >
+    class hfun_query_k
+    {
+    /*------------ a small fixed-size buffer of pending H(x)
+     * queries: callers PUSH point/hint/value triples, and
+     * FLUSH evaluates them in one batch via the size-fun.
+     * EVAL(PNUM,PPOS,HINT,HVAL) interface, scattering the
+     * values and updated hints back to their owners. Each
+     * thread is expected to use its own buffer.
+     */
+    public  :
+
+    typedef typename
+            hfun_type::real_type    real_type ;
+    typedef typename
+            hfun_type::iptr_type    iptr_type ;
+    typedef typename
+            hfun_type::hint_type    hint_type ;
+
+    hfun_type                     *_hfun ;
+
+    iptr_type                      _pnum ;
+
+    real_type                      _ppos[SIZE * NDIM] ;
+    hint_type                      _hint[SIZE] ;
+    real_type                      _hval[SIZE] ;
+
+    hint_type                     *_href[SIZE] ;
+    real_type                     *_hdst[SIZE] ;
+
+    hint_type                      _hcpy[SIZE] ;
+
+    public  :
+
+    __inline_call hfun_query_k (
+        hfun_type &_hsrc
+        ) : _hfun(&_hsrc), _pnum(+0) {}
+
+    __inline_call ~hfun_query_k (
+        )
+    {   flush() ;
+    }
+
+    /*------------ queue a query, flush buffer once full */
+
+    __inline_call void_type push (
+      __const_ptr(real_type) _ppos ,
+        hint_type &_hint ,
+        real_type &_hval
+        )
+    {
+        if (this->_pnum ==
+                (iptr_type) SIZE) flush() ;
+
+        iptr_type _ioff =
+            this->_pnum * (iptr_type) NDIM ;
+
+        for (auto _idim = NDIM; _idim-- != 0; )
+        {
+            this->_ppos[_ioff+_idim] =
+                    _ppos[_idim] ;
+        }
+
+        this->_hint[this->_pnum] =  _hint;
+        this->_href[this->_pnum] = &_hint;
+        this->_hdst[this->_pnum] = &_hval;
+
+        this->_pnum += +1 ;
+    }
+
+    /*------------ queue a query w/out hint write-back */
+
+    __inline_call void_type push_copy (
+      __const_ptr(real_type) _ppos ,
+        hint_type  _hint ,
+        real_type &_hval
+        )
+    {
+        if (this->_pnum ==
+                (iptr_type) SIZE) flush() ;
+
+        this->_hcpy[this->_pnum] = _hint;
+
+        push(_ppos,
+            this->_hcpy[this->_pnum], _hval) ;
+    }
+
+    /*------------ eval. pending queries and write back */
+
+    __inline_call void_type flush (
+        )
+    {
+        if (this->_pnum == +0) return ;
+
+        this->_hfun->eval(this->_pnum,
+            this->_ppos,
+            this->_hint, this->_hval) ;
+
+        for (iptr_type _ipos = +0 ;
+                  _ipos != this->_pnum;
+                ++_ipos )
+        {
+           *this->_href[_ipos] =
+                this->_hint[_ipos] ;
+           *this->_hdst[_ipos] =
+                this->_hval[_ipos] ;
+        }
+
+        this->_pnum = +0 ;
+    }
+
+    } ;
+
+
+    }
+
+#   endif   //__HFUN_QUERY_K__
+
+
+
@@ -0,0 +1,371 @@
+
+    /*
+    --------------------------------------------------------
+     * HFUN-SWEEP-kD: tiled fast-sweeping for grid H(x).
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2013-2020
+     * Darren Engwirda
+     * d.engwirda@gmail.com
+     * https://github.com/dengwirda
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __HFUN_SWEEP_K__
+#   define __HFUN_SWEEP_K__
+
+    namespace mesh {
+
+    /*
+    --------------------------------------------------------
+     * MARK-RING: re-activate tile and its boundary cells.
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  iptr_type ,
+        typename  flag_list
+             >
+    __normal_call void_type mark_ring (
+        iptr_type  _inum ,
+        iptr_type  _jnum ,
+        iptr_type  _TILE ,
+        iptr_type  _it ,
+        iptr_type  _jt ,
+        flag_list &_live ,
+        flag_list &_todo
+        )
+    {
+        iptr_type _itil =
+           (_inum + _TILE - 1) / _TILE ;
+
+        iptr_type _ibeg = _it * _TILE ;
+        iptr_type _iend = std::min(
+            _ibeg + _TILE, _inum) ;
+
+        iptr_type _jbeg = _jt * _TILE ;
+        iptr_type _jend = std::min(
+            _jbeg + _TILE, _jnum) ;
+
+        _live[_jt * _itil + _it] = +1 ;
+
+        for (auto _jpos = _jbeg ;
+                  _jpos < _jend; ++_jpos)
+        {
+            _todo[_jpos * _inum + _ibeg] = +1 ;
+            _todo[_jpos * _inum + _iend - 1] = +1 ;
+        }
+
+        for (auto _ipos = _ibeg ;
+                  _ipos < _iend; ++_ipos)
+        {
+            _todo[_jbeg * _inum + _ipos] = +1 ;
+            _todo[(_jend - 1) * _inum + _ipos] = +1 ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * SWEEP-TILE-2D: block fast-sweeping on cell arrays.
+    --------------------------------------------------------
+     */
+
+    // Impose |dh/dx| limits on a structured array of INUM
+    // x JNUM cells by Gauss-Seidel sweeps, tiled in blocks
+    // of TILE x TILE cells. Tiles are split into 2 x 2
+    // "colours", so that tiles of a colour share no nodes
+    // and can be swept concurrently over CPUS threads.
+    // Each tile is swept in 4 alternating orders until
+    // converged, with neighbouring tiles re-activated on
+    // change. Colours are visited in a fixed order, so
+    // results do not depend on the thread count.
+    //
+    // Cells are only re-solved once an adj. node changes:
+    // a changed cell marks its neighbours in the tile,
+    // and re-activated tiles mark their boundary cells.
+    //
+    // CELL(i,j) clips cell (i,j), returning TRUE if any
+    // h-value is reduced. If WRAP, PAIR(i) takes the min.
+    // over the periodic nodes in row i, returning TRUE on
+    // change.
+
+    template <
+        typename  iptr_type ,
+        typename  cell_pred ,
+        typename  pair_pred
+             >
+    __normal_call void_type sweep_tile_2d (
+        iptr_type  _inum ,
+        iptr_type  _jnum ,
+        iptr_type  _cpus ,
+        bool_type  _wrap ,
+        cell_pred &_cell ,
+        pair_pred &_pair
+        )
+    {
+        typedef containers::array <
+                iptr_type >         iptr_list ;
+
+        typedef containers::array <
+                char_type >         flag_list ;
+
+        iptr_type static constexpr
+            _TILE = (iptr_type) +64 ;
+
+        if (_inum <= +0) return ;
+        if (_jnum <= +0) return ;
+
+        iptr_type _nthr =
+            std::max(+1, _cpus) ;
+
+        iptr_type _itil =
+           (_inum + _TILE - 1) / _TILE ;
+        iptr_type _jtil =
+           (_jnum + _TILE - 1) / _TILE ;
+
+    /*-------------------- tile (it, jt) at jt * ITIL + it */
+        flag_list _live (
+            _itil * _jtil, (char_type) +1) ;
+        flag_list _diff (
+            _itil * _jtil, (char_type) +0) ;
+
+    /*-------------------- cell (i, j) at j * INUM + i    */
+        flag_list _todo (
+            _inum * _jnum, (char_type) +1) ;
+
+        iptr_list _work ;
+
+        std::exception_ptr _fail = nullptr ;
+
+    /*-------------------- init. values for periodic bc's */
+        if (_wrap)
+        for (auto _ipos = (iptr_type)+0 ;
+                  _ipos <= _inum; ++_ipos)
+        {
+            _pair(_ipos) ;
+        }
+
+        for ( ; ; )
+        {
+            bool_type _done = true ;
+
+        for (auto _icol = +0 ; _icol < +4; ++_icol)
+        {
+    /*-------------------- collect active tiles in colour */
+            _work.set_count( +0) ;
+
+            for (auto _jt = _icol / 2 ;
+                      _jt < _jtil; _jt += 2)
+            for (auto _it = _icol % 2 ;
+                      _it < _itil; _it += 2)
+            {
+                iptr_type _tpos =
+                    _jt * _itil + _it ;
+
+                if (_live[_tpos] > +0)
+                {
+                    _live[_tpos] = +0 ;
+                    _work.push_tail(_tpos) ;
+                }
+            }
+
+            if (_work.empty()) continue ;
+
+            _done = false ;
+
+    /*-------------------- sweep tiles in colour, in para */
+            iptr_type _wnum =
+           (iptr_type)_work.count() ;
+
+    #       ifdef  __use_openmp
+    #       pragma omp parallel for \
+            num_threads(_nthr) schedule(dynamic, 1)
+    #       endif//__use_openmp
+            for (auto _wpos = (iptr_type)+0 ;
+                      _wpos < _wnum; ++_wpos)
+            {
+            try
+            {
+                iptr_type _tpos = _work[_wpos] ;
+
+                iptr_type _it = _tpos % _itil ;
+                iptr_type _jt = _tpos / _itil ;
+
+                iptr_type _ibeg = _it * _TILE ;
+                iptr_type _iend = std::min(
+                    _ibeg + _TILE, _inum) ;
+
+                iptr_type _jbeg = _jt * _TILE ;
+                iptr_type _jend = std::min(
+                    _jbeg + _TILE, _jnum) ;
+
+                _diff[_tpos] = +0 ;
+
+                for ( ; ; )
+                {
+                    bool_type _move = false ;
+
+                for (auto _sdir = +0 ;
+                          _sdir < +4; ++_sdir)
+                {
+    /*-------------------- alternate +/- sweep directions */
+                    bool_type _iinc =
+                        (_sdir % 2) == 0 ;
+                    bool_type _jinc =
+                        (_sdir / 2) == 0 ;
+
+                for (auto _jj = _jbeg ;
+                          _jj < _jend; ++_jj)
+                {
+                    iptr_type _jpos = _jinc ?
+                        _jj : _jend - 1 - (_jj - _jbeg) ;
+
+                for (auto _ii = _ibeg ;
+                          _ii < _iend; ++_ii)
+                {
+                    iptr_type _ipos = _iinc ?
+                        _ii : _iend - 1 - (_ii - _ibeg) ;
+
+                    iptr_type _cpos =
+                        _jpos * _inum + _ipos ;
+
+                    if (_todo[_cpos] == +0) continue ;
+
+                    _todo[_cpos] = +0 ;
+
+                    if (!_cell(_ipos, _jpos)) continue ;
+
+    /*-------------------- mark adj. cells within the tile */
+                    _move = true ;
+
+                    iptr_type _imin =
+                        std::max(_ipos - 1, _ibeg) ;
+                    iptr_type _imax =
+                        std::min(_ipos + 2, _iend) ;
+
+                    iptr_type _jmin =
+                        std::max(_jpos - 1, _jbeg) ;
+                    iptr_type _jmax =
+                        std::min(_jpos + 2, _jend) ;
+
+                    for (auto _JPOS = _jmin ;
+                              _JPOS < _jmax; ++_JPOS)
+                    for (auto _IPOS = _imin ;
+                              _IPOS < _imax; ++_IPOS)
+                    {
+                        _todo[_JPOS * _inum + _IPOS] = +1 ;
+                    }
+                }
+                }
+                }
+
+                    if (!_move) break ;
+
+                    _diff[_tpos] = +1 ;
+                }
+            }
+            catch (...)
+            {
+    #       ifdef  __use_openmp
+    #       pragma omp critical
+    #       endif//__use_openmp
+                _fail = std::current_exception() ;
+            }
+            }
+
+            if (_fail) std::rethrow_exception(_fail);
+
+    /*-------------------- re-activate tiles adj. to diff */
+            for (auto _iter  = _work.head() ;
+                      _iter != _work.tend() ;
+                    ++_iter  )
+            {
+                if (_diff[*_iter] == +0) continue ;
+
+                iptr_type _it = *_iter % _itil ;
+                iptr_type _jt = *_iter / _itil ;
+
+                for (auto _JT = _jt - 1 ;
+                          _JT <= _jt + 1 ; ++_JT)
+                for (auto _IT = _it - 1 ;
+                          _IT <= _it + 1 ; ++_IT)
+                {
+                    if (_IT < +0 || _IT >= _itil)
+                        continue ;
+                    if (_JT < +0 || _JT >= _jtil)
+                        continue ;
+
+                    if (_IT == _it && _JT == _jt)
+                        continue ;
+
+                    mark_ring(_inum, _jnum, _TILE,
+                        _IT, _JT, _live, _todo) ;
+                }
+            }
+
+    /*-------------------- re-sync values for periodic bc */
+            if (_wrap)
+            for (auto _ipos = (iptr_type)+0 ;
+                      _ipos <= _inum; ++_ipos)
+            {
+                if (!_pair(_ipos)) continue ;
+
+                for (auto _IPOS = _ipos - 1 ;
+                          _IPOS <= _ipos ; ++_IPOS)
+                {
+                    if (_IPOS < +0 || _IPOS >= _inum)
+                        continue ;
+
+                    iptr_type _it = _IPOS / _TILE ;
+
+                    mark_ring(_inum, _jnum, _TILE,
+                        _it, (iptr_type)+0, _live, _todo) ;
+                    mark_ring(_inum, _jnum, _TILE,
+                        _it, _jtil - 1, _live, _todo) ;
+                }
+            }
+        }
+
+            if (_done) break ;
+        }
+    }
+
+
+    }
+
+#   endif//__HFUN_SWEEP_K__
+
+
+
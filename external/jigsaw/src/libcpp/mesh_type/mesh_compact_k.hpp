@@ -0,0 +1,826 @@
+    /*
+    --------------------------------------------------------
+     * MESH-COMPACT-K: compact "bulk" mesh snapshots.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2013-2020
+     * Darren Engwirda
+     * d.engwirda@gmail.com
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __MESH_COMPACT_K__
+#   define __MESH_COMPACT_K__
+
+    namespace mesh {
+
+    /*
+    --------------------------------------------------------
+     * MESH-COMPACT-K: a static SoA mixed-cell complex.
+    --------------------------------------------------------
+     * REAL-TYPE - floating-point typedef.
+     * IPTR-TYPE - signed-integer typedef.
+     * GEOM-DIMS - no. of coord.'s per node.
+    --------------------------------------------------------
+     */
+
+    // A "frozen" copy of a MESH-COMPLEX, holding only its
+    // active nodes + cells. Nodes are renumbered in order,
+    // with coord.'s (and the power weight) stored as
+    // separate arrays. Cells of each kind are stored as
+    // flat NNOD x CNUM node lists, with ID-tags alongside.
+    // All arrays share one arena block, sized before being
+    // filled.
+    //
+    // A "topo." snapshot skips the coord.'s and instead
+    // keeps node-to-cell adj. in CSR form (sorted by kind
+    // then cell, built in bulk), plus maps back to source
+    // node + cell indices, so that CONNECT-1/2 queries can
+    // be answered without walking the hashed adj. lists.
+    // This is valid until the source topology is changed.
+
+    template <
+    typename R ,
+    typename I ,
+    std::size_t D
+             >
+    class mesh_compact_k
+    {
+/*------------------------------ compact mesh-complex in R^d */
+    public  :
+    typedef R                           real_type ;
+    typedef I                           iptr_type ;
+
+    typedef std::size_t                 size_type ;
+
+    typedef allocators::_arena_alloc <
+            allocators::basic_alloc >   pool_type ;
+
+    typedef mesh_compact_k  <
+                real_type ,
+                iptr_type , D       >   self_type ;
+
+    size_type static constexpr geom_dims = D ;
+
+    iptr_type static constexpr kind_nums = +4 ;
+
+    iptr_type static constexpr edge_kind = +0 ;
+    iptr_type static constexpr tri3_kind = +1 ;
+    iptr_type static constexpr quad_kind = +2 ;
+    iptr_type static constexpr tri4_kind = +3 ;
+
+    public  :
+
+    pool_type                          _pool ;
+
+    iptr_type                          _nnum = +0 ;
+
+    real_type                         *_pval [D + 1] ;
+
+    iptr_type                          _cnum [ +4] ;
+    iptr_type                         *_cnod [ +4] ;
+    iptr_type                         *_ctag [ +4] ;
+
+    iptr_type                          _snum = +0 ;
+    iptr_type                         *_nmap = nullptr ;
+    iptr_type                         *_cmap [ +4] ;
+
+    iptr_type                         *_aptr = nullptr ;
+    iptr_type                         *_acel = nullptr ;
+    char_type                         *_akin = nullptr ;
+
+    public  :
+
+    /*
+    --------------------------------------------------------
+     * NODE-NUMS: no. of nodes per cell kind.
+    --------------------------------------------------------
+     */
+
+    __static_call
+    __inline_call iptr_type node_nums (
+        iptr_type _kind
+        )
+    {
+        return _kind == edge_kind ? +2 :
+               _kind == tri3_kind ? +3 : +4 ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * MESH-COMPACT-K: construct / destruct.
+    --------------------------------------------------------
+     */
+
+    __inline_call  mesh_compact_k (
+        )
+    {
+        clear () ;
+    }
+
+    __inline_call ~mesh_compact_k (
+        ) = default ;
+
+    /*
+    --------------------------------------------------------
+     * CLEAR: release arena, reset all counts.
+    --------------------------------------------------------
+     */
+
+    __inline_call void_type clear (
+        )
+    {
+        this->_pool.clear() ;
+
+        this->_nnum = +0 ;
+
+        for (auto _idim = +0 ;
+                  _idim < (iptr_type)D + 1 ; ++_idim)
+        {
+            this->_pval[_idim] = nullptr ;
+        }
+
+        for (auto _kind = +0 ;
+                  _kind < kind_nums; ++_kind)
+        {
+            this->_cnum[_kind] = +0 ;
+            this->_cnod[_kind] = nullptr ;
+            this->_ctag[_kind] = nullptr ;
+            this->_cmap[_kind] = nullptr ;
+        }
+
+        this->_snum = +0 ;
+        this->_nmap = nullptr ;
+
+        this->_aptr = nullptr ;
+        this->_acel = nullptr ;
+        this->_akin = nullptr ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * RESERVE: size arena for NNUM nodes + CNUM cells.
+    --------------------------------------------------------
+     */
+
+    // SNUM < 0 reserves a full snapshot, with coord.'s.
+    // SNUM >= 0 reserves a "topo." snapshot instead, with
+    // maps for SNUM source nodes, and CSR adj.
+
+    __normal_call void_type reserve (
+        iptr_type _nnum ,
+        iptr_type const*_cnum ,
+        iptr_type _snum = -1
+        )
+    {
+        clear () ;
+
+    /*---------------------------- total of all cell adj. */
+        size_type _nadj = +0 ;
+        for (auto _kind = +0 ;
+                  _kind < kind_nums; ++_kind)
+        {
+            _nadj += (size_type)_cnum[_kind] *
+                     (size_type)node_nums(_kind) ;
+        }
+
+    /*---------------------------- one block for all data */
+        size_type _size = +0 ;
+
+        if (_snum < +0)
+        _size +=
+           (D + 1) * pool_type::aligned(
+              (size_type)_nnum * sizeof(real_type)) ;
+
+        for (auto _kind = +0 ;
+                  _kind < kind_nums; ++_kind)
+        {
+            _size += pool_type::aligned(
+              (size_type)_cnum[_kind] *
+              (size_type)node_nums(_kind) *
+                 sizeof(iptr_type)) ;
+            _size += pool_type::aligned(
+              (size_type)_cnum[_kind] *
+                 sizeof(iptr_type)) ;
+
+            if (_snum >= +0)
+            _size += pool_type::aligned(
+              (size_type)_cnum[_kind] *
+                 sizeof(iptr_type)) ;
+        }
+
+        if (_snum >= +0)
+        {
+        _size += pool_type::aligned(
+            (size_type)_snum * sizeof(iptr_type)) ;
+        _size += pool_type::aligned(
+          ((size_type)_nnum + 1) * sizeof(iptr_type)) ;
+        _size += pool_type::aligned(
+            _nadj * sizeof(iptr_type)) ;
+        _size += pool_type::aligned(
+            _nadj * sizeof(char_type)) ;
+        }
+
+        this->_pool.reserve(_size) ;
+
+    /*---------------------------- carve arena into lists */
+        this->_nnum = _nnum ;
+
+        if (_snum < +0)
+        for (auto _idim = +0 ;
+                  _idim < (iptr_type)D + 1 ; ++_idim)
+        {
+            this->_pval[_idim] = this->_pool.
+                template allocate<real_type>(_nnum) ;
+        }
+
+        for (auto _kind = +0 ;
+                  _kind < kind_nums; ++_kind)
+        {
+            this->_cnum[_kind] = _cnum[_kind] ;
+
+            this->_cnod[_kind] = this->_pool.
+                template allocate<iptr_type>(
+                    _cnum[_kind] * node_nums(_kind)) ;
+
+            this->_ctag[_kind] = this->_pool.
+                template allocate<iptr_type>(
+                    _cnum[_kind]) ;
+
+            if (_snum >= +0)
+            this->_cmap[_kind] = this->_pool.
+                template allocate<iptr_type>(
+                    _cnum[_kind]) ;
+        }
+
+        if (_snum >= +0)
+        {
+        this->_snum = _snum ;
+
+        this->_nmap = this->_pool.
+            template allocate<iptr_type>(_snum) ;
+
+        this->_aptr = this->_pool.
+            template allocate<iptr_type>(_nnum + 1) ;
+        this->_acel = this->_pool.
+            template allocate<iptr_type>(_nadj) ;
+        this->_akin = this->_pool.
+            template allocate<char_type>(_nadj) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * MAKE-ADJS: build node-to-cell adj. in bulk.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type make_adjs (
+        )
+    {
+    /*---------------------------- count cells about node */
+        for (auto _npos = +0 ;
+                  _npos <= this->_nnum; ++_npos)
+        {
+            this->_aptr[_npos] = +0 ;
+        }
+
+        for (auto _kind = +0 ;
+                  _kind < kind_nums; ++_kind)
+        {
+            iptr_type _nnod = node_nums(_kind) ;
+            iptr_type _nlen =
+                this->_cnum[_kind] * _nnod ;
+
+            for (auto _ipos = +0 ;
+                      _ipos < _nlen; ++_ipos)
+            {
+                this->_aptr[
+                this->_cnod[_kind][_ipos] + 1] += 1 ;
+            }
+        }
+
+    /*---------------------------- prefix-sum into offset */
+        for (auto _npos = +0 ;
+                  _npos < this->_nnum; ++_npos)
+        {
+            this->_aptr[_npos + 1] +=
+                this->_aptr[_npos + 0] ;
+        }
+
+    /*---------------------------- scatter cells into adj */
+        for (auto _kind = +0 ;
+                  _kind < kind_nums; ++_kind)
+        {
+            iptr_type _nnod = node_nums(_kind) ;
+
+            for (auto _cell = +0 ;
+                      _cell < this->_cnum[_kind];
+                    ++_cell  )
+            {
+            for (auto _inod = +0 ;
+                      _inod < _nnod; ++_inod)
+            {
+                iptr_type _node =  this->
+                _cnod[_kind][_cell * _nnod + _inod] ;
+
+                iptr_type _apos =
+                    this->_aptr[_node]++ ;
+
+                this->_acel[_apos] = _cell ;
+                this->_akin[_apos] =
+                    (char_type)_kind ;
+            }
+            }
+        }
+
+    /*---------------------------- shift offset back by 1 */
+        for (auto _npos = this->_nnum ;
+                  _npos > +0; --_npos)
+        {
+            this->_aptr[_npos] =
+                this->_aptr[_npos - 1] ;
+        }
+            this->_aptr[+0] = +0 ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * ADJS-HEAD/TEND: CSR range of cells about node.
+    --------------------------------------------------------
+     */
+
+    __inline_call iptr_type adjs_head (
+        iptr_type _npos
+        ) const
+    {
+        return this->_aptr[_npos + 0] ;
+    }
+
+    __inline_call iptr_type adjs_tend (
+        iptr_type _npos
+        ) const
+    {
+        return this->_aptr[_npos + 1] ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * CONNECT-1/2: source 1-/2-cells about source node.
+    --------------------------------------------------------
+     */
+
+    // As per MESH-COMPLEX::CONNECT-1/2 for a POINT, but
+    // read from the CSR adj. of a "topo." snapshot. Cells
+    // are pushed as (source index, kind tag) pairs, in
+    // kind then cell order.
+
+    template <
+    typename      conn_list
+             >
+    __normal_call void_type connect_1 (
+        iptr_type _node ,
+        conn_list&_conn
+        ) const
+    {
+        iptr_type _npos = this->_nmap[_node] ;
+
+        if (_npos < +0) return ;
+
+        for (auto _apos  = adjs_head(_npos) ;
+                  _apos != adjs_tend(_npos) ;
+                ++_apos  )
+        {
+            if (this->_akin[_apos] == edge_kind)
+            {
+                _conn.push_tail(typename
+                    conn_list::data_type(
+                this->_cmap[edge_kind]
+                    [this->_acel[_apos]], EDGE2_tag)) ;
+            }
+        }
+    }
+
+    template <
+    typename      conn_list
+             >
+    __normal_call void_type connect_2 (
+        iptr_type _node ,
+        conn_list&_conn
+        ) const
+    {
+        iptr_type _npos = this->_nmap[_node] ;
+
+        if (_npos < +0) return ;
+
+        for (auto _apos  = adjs_head(_npos) ;
+                  _apos != adjs_tend(_npos) ;
+                ++_apos  )
+        {
+            if (this->_akin[_apos] == tri3_kind)
+            {
+                _conn.push_tail(typename
+                    conn_list::data_type(
+                this->_cmap[tri3_kind]
+                    [this->_acel[_apos]], TRIA3_tag)) ;
+            }
+            else
+            if (this->_akin[_apos] == quad_kind)
+            {
+                _conn.push_tail(typename
+                    conn_list::data_type(
+                this->_cmap[quad_kind]
+                    [this->_acel[_apos]], QUAD4_tag)) ;
+            }
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * BYTES: memory footprint of the arena block.
+    --------------------------------------------------------
+     */
+
+    __inline_call size_type bytes (
+        ) const
+    {
+        return this->_pool.bytes() +
+               sizeof(self_type) ;
+    }
+
+    } ;
+
+    /*
+    --------------------------------------------------------
+     * MAKE-COMPACT: snapshot a mesh-complex in bulk.
+    --------------------------------------------------------
+     */
+
+    // Takes all cells with MARK >= 0 and SELF >= 1, and
+    // the nodes they reference, as per the *.MSH writer.
+    // Sizes are counted in one pass, the arena reserved,
+    // then nodes + cells filled in a second pass. With
+    // TOPO, a "topo." snapshot is formed instead, with
+    // source maps + CSR adj. in place of the coord.'s.
+
+    template <
+    typename      mesh_type ,
+    typename      comp_type
+             >
+    __normal_call void_type make_compact (
+        mesh_type const&_mesh ,
+        comp_type      &_comp ,
+        bool_type       _topo = false
+        )
+    {
+        typedef typename
+                comp_type::iptr_type    iptr_type ;
+
+        containers::array<iptr_type> _nmap ;
+
+        _nmap.set_count(_mesh.node().count(),
+            containers::tight_alloc, -1) ;
+
+        iptr_type _cnum[+4] = { +0, +0, +0, +0 } ;
+        iptr_type _nnum = +0 ;
+
+    /*---------------------------- mark + count all cells */
+        for (auto _iter  = _mesh.edge().head() ;
+                  _iter != _mesh.edge().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() >= +0 &&
+                _iter->self() >= +1 )
+            {
+            _nmap[_iter->node(0)] = +1 ;
+            _nmap[_iter->node(1)] = +1 ;
+            _cnum[comp_type::edge_kind] += +1 ;
+            }
+        }
+
+        for (auto _iter  = _mesh.tri3().head() ;
+                  _iter != _mesh.tri3().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() >= +0 &&
+                _iter->self() >= +1 )
+            {
+            _nmap[_iter->node(0)] = +1 ;
+            _nmap[_iter->node(1)] = +1 ;
+            _nmap[_iter->node(2)] = +1 ;
+            _cnum[comp_type::tri3_kind] += +1 ;
+            }
+        }
+
+        for (auto _iter  = _mesh.quad().head() ;
+                  _iter != _mesh.quad().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() >= +0 &&
+                _iter->self() >= +1 )
+            {
+            _nmap[_iter->node(0)] = +1 ;
+            _nmap[_iter->node(1)] = +1 ;
+            _nmap[_iter->node(2)] = +1 ;
+            _nmap[_iter->node(3)] = +1 ;
+            _cnum[comp_type::quad_kind] += +1 ;
+            }
+        }
+
+        if constexpr (mesh_type::topo_dims >= +3)
+        {
+        for (auto _iter  = _mesh.tri4().head() ;
+                  _iter != _mesh.tri4().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() >= +0 &&
+                _iter->self() >= +1 )
+            {
+            _nmap[_iter->node(0)] = +1 ;
+            _nmap[_iter->node(1)] = +1 ;
+            _nmap[_iter->node(2)] = +1 ;
+            _nmap[_iter->node(3)] = +1 ;
+            _cnum[comp_type::tri4_kind] += +1 ;
+            }
+        }
+        }
+
+    /*---------------------------- renumber active nodes */
+        for (auto _iter  = _nmap.head() ;
+                  _iter != _nmap.tend() ;
+                ++_iter  )
+        {
+            if ( *_iter >= +0)
+            {
+                 *_iter = _nnum ++ ;
+            }
+        }
+
+        _comp.reserve(_nnum, _cnum, _topo ?
+            (iptr_type)_mesh.node().count() : -1) ;
+
+        if (_topo)
+        {
+    /*---------------------------- keep source-node map */
+        for (auto _npos = +0 ;
+            _npos != (iptr_type)_nmap.count() ;
+                ++_npos  )
+        {
+            _comp._nmap[_npos] = _nmap[_npos] ;
+        }
+        }
+        else
+        {
+    /*---------------------------- fill SoA node coord.'s */
+        iptr_type _npos = +0 ;
+        for (auto _iter  = _mesh.node().head() ;
+                  _iter != _mesh.node().tend() ;
+                ++_iter, ++_npos)
+        {
+            if (_iter->mark() >= +0 &&
+                _nmap[_npos ] >= +0 )
+            {
+            for (auto _idim = +0 ;
+                      _idim < (iptr_type)
+                      comp_type::geom_dims + 1 ;
+                    ++_idim  )
+            {
+                _comp._pval[_idim][_nmap[_npos]] =
+                    _iter->pval(_idim) ;
+            }
+            }
+        }
+        }
+
+    /*---------------------------- fill flat cell arrays */
+        iptr_type _cpos, _ipos ;
+
+        _cpos = +0 ; _ipos = +0 ;
+        for (auto _iter  = _mesh.edge().head() ;
+                  _iter != _mesh.edge().tend() ;
+                ++_iter, ++_ipos)
+        {
+            if (_iter->mark() >= +0 &&
+                _iter->self() >= +1 )
+            {
+            iptr_type *_cnod = &_comp.
+                _cnod[comp_type::edge_kind][_cpos * 2] ;
+
+            _cnod[0] = _nmap[_iter->node(0)] ;
+            _cnod[1] = _nmap[_iter->node(1)] ;
+
+            if (_topo)
+            _comp._cmap[comp_type::edge_kind]
+                [_cpos] = _ipos ;
+
+            _comp._ctag[comp_type::edge_kind]
+                [_cpos ++] = _iter->itag() ;
+            }
+        }
+
+        _cpos = +0 ; _ipos = +0 ;
+        for (auto _iter  = _mesh.tri3().head() ;
+                  _iter != _mesh.tri3().tend() ;
+                ++_iter, ++_ipos)
+        {
+            if (_iter->mark() >= +0 &&
+                _iter->self() >= +1 )
+            {
+            iptr_type *_cnod = &_comp.
+                _cnod[comp_type::tri3_kind][_cpos * 3] ;
+
+            _cnod[0] = _nmap[_iter->node(0)] ;
+            _cnod[1] = _nmap[_iter->node(1)] ;
+            _cnod[2] = _nmap[_iter->node(2)] ;
+
+            if (_topo)
+            _comp._cmap[comp_type::tri3_kind]
+                [_cpos] = _ipos ;
+
+            _comp._ctag[comp_type::tri3_kind]
+                [_cpos ++] = _iter->itag() ;
+            }
+        }
+
+        _cpos = +0 ; _ipos = +0 ;
+        for (auto _iter  = _mesh.quad().head() ;
+                  _iter != _mesh.quad().tend() ;
+                ++_iter, ++_ipos)
+        {
+            if (_iter->mark() >= +0 &&
+                _iter->self() >= +1 )
+            {
+            iptr_type *_cnod = &_comp.
+                _cnod[comp_type::quad_kind][_cpos * 4] ;
+
+            _cnod[0] = _nmap[_iter->node(0)] ;
+            _cnod[1] = _nmap[_iter->node(1)] ;
+            _cnod[2] = _nmap[_iter->node(2)] ;
+            _cnod[3] = _nmap[_iter->node(3)] ;
+
+            if (_topo)
+            _comp._cmap[comp_type::quad_kind]
+                [_cpos] = _ipos ;
+
+            _comp._ctag[comp_type::quad_kind]
+                [_cpos ++] = _iter->itag() ;
+            }
+        }
+
+        if constexpr (mesh_type::topo_dims >= +3)
+        {
+        _cpos = +0 ; _ipos = +0 ;
+        for (auto _iter  = _mesh.tri4().head() ;
+                  _iter != _mesh.tri4().tend() ;
+                ++_iter, ++_ipos)
+        {
+            if (_iter->mark() >= +0 &&
+                _iter->self() >= +1 )
+            {
+            iptr_type *_cnod = &_comp.
+                _cnod[comp_type::tri4_kind][_cpos * 4] ;
+
+            _cnod[0] = _nmap[_iter->node(0)] ;
+            _cnod[1] = _nmap[_iter->node(1)] ;
+            _cnod[2] = _nmap[_iter->node(2)] ;
+            _cnod[3] = _nmap[_iter->node(3)] ;
+
+            if (_topo)
+            _comp._cmap[comp_type::tri4_kind]
+                [_cpos] = _ipos ;
+
+            _comp._ctag[comp_type::tri4_kind]
+                [_cpos ++] = _iter->itag() ;
+            }
+        }
+        }
+
+    /*---------------------------- node-to-cell CSR adj. */
+        if (_topo) _comp.make_adjs() ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * MESH-BYTES: footprint of a dynamic mesh-complex.
+    --------------------------------------------------------
+     */
+
+    // An estimate of the heap memory held by the linked
+    // MESH-COMPLEX layout: record lists, free lists, hash
+    // maps + adj. lists, counting alloc.'d slots and one
+    // pool item per live entry.
+
+    template <
+    typename      list_type
+             >
+    __inline_call std::size_t list_bytes (
+        list_type const&_list
+        )
+    {
+        return _list.alloc() * sizeof(
+            typename list_type::data_type) ;
+    }
+
+    template <
+    typename      hash_type
+             >
+    __inline_call std::size_t hash_bytes (
+        hash_type const&_hash
+        )
+    {
+        return _hash._lptr.alloc() * sizeof(
+            typename hash_type::item_type *)
+             + _hash.count() * sizeof(
+            typename hash_type::item_type  ) ;
+    }
+
+    template <
+    typename      mesh_type
+             >
+    __normal_call std::size_t mesh_bytes (
+        mesh_type const&_mesh
+        )
+    {
+        std::size_t _size = sizeof(mesh_type) ;
+
+        _size += list_bytes(_mesh._llN1) ;
+        _size += list_bytes(_mesh._llE2) ;
+        _size += list_bytes(_mesh._llT3) ;
+        _size += list_bytes(_mesh._llQ4) ;
+
+        _size += list_bytes(_mesh._ffN1) ;
+        _size += list_bytes(_mesh._ffE2) ;
+        _size += list_bytes(_mesh._ffT3) ;
+        _size += list_bytes(_mesh._ffQ4) ;
+
+        _size += hash_bytes(_mesh._mmE2) ;
+        _size += hash_bytes(_mesh._mmT3) ;
+        _size += hash_bytes(_mesh._mmQ4) ;
+
+        _size += hash_bytes(_mesh._aaN1) ;
+        _size += hash_bytes(_mesh._aaE2) ;
+
+        if constexpr (mesh_type::topo_dims >= +3)
+        {
+        _size += list_bytes(_mesh._llT4) ;
+        _size += list_bytes(_mesh._llH8) ;
+        _size += list_bytes(_mesh._llW6) ;
+        _size += list_bytes(_mesh._llP5) ;
+
+        _size += list_bytes(_mesh._ffT4) ;
+        _size += list_bytes(_mesh._ffH8) ;
+        _size += list_bytes(_mesh._ffW6) ;
+        _size += list_bytes(_mesh._ffP5) ;
+
+        _size += hash_bytes(_mesh._mmT4) ;
+        _size += hash_bytes(_mesh._mmH8) ;
+        _size += hash_bytes(_mesh._mmW6) ;
+        _size += hash_bytes(_mesh._mmP5) ;
+
+        _size += hash_bytes(_mesh._aaT3) ;
+        _size += hash_bytes(_mesh._aaQ4) ;
+        }
+
+        return ( _size ) ;
+    }
+
+
+    }
+
+#   endif//__MESH_COMPACT_K__
+
+
+
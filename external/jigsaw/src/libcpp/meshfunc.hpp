@@ -57,6 +57,8 @@
 
 #   include "mesh_func/hfun_base_k.hpp"
 #   include "mesh_func/hfun_clip_k.hpp"
+#   include "mesh_func/hfun_sweep_k.hpp"
+#   include "mesh_func/hfun_query_k.hpp"
 
 #   include "mesh_func/hfun_constant_value_k.hpp"
 
@@ -77,6 +77,8 @@
 #   include "mesh_type/mesh_complex_2.hpp"
 #   include "mesh_type/mesh_complex_3.hpp"
 
+#   include "mesh_type/mesh_compact_k.hpp"
+
 #   endif//__MESHTYPE__
 
 
@@ -79,6 +79,8 @@
         bool_type        _tria ;
         bool_type        _dual ;
 
+        iptr_type        _cpus ;
+
         public  :
 
     /*-------------------------- construct default param. */
@@ -94,7 +96,9 @@
             _zip_ ((bool_type)  true  ) ,
             _div_ ((bool_type)  true  ) ,
             _tria ((bool_type)  true  ) ,
-            _dual ((bool_type)  false )
+            _dual ((bool_type)  false ) ,
+
+            _cpus ((iptr_type) +   1  )
         {   // load default values
         }
 
@@ -135,6 +139,11 @@
         {   return  this->_dual ;
         }
 
+        __inline_call iptr_type      & cpus (
+            )
+        {   return  this->_cpus ;
+        }
+
     /*------------------------------------ "const" access */
         __inline_call iptr_type const& verb (
             ) const
@@ -172,6 +181,11 @@
         {   return  this->_dual ;
         }
 
+        __inline_call iptr_type const& cpus (
+            ) const
+        {   return  this->_cpus ;
+        }
+
         } ;
 
     }
@@ -94,6 +94,8 @@
 
         iptr_type   _dims ;     // topo. dimensions to mesh
 
+        iptr_type   _cpus ;     // num. threads for init. DT
+
         iptr_type   _iter ;     // max. num. refine iter.
 
         iptr_type   _rule ;     // rule for cell refinement
@@ -181,6 +183,8 @@
 
             _dims(iptr_type(+   3)) ,
 
+            _cpus(iptr_type(+   1)) ,
+
             _iter(init_iter())  ,
 
             _rule(init_rule())  ,
@@ -262,6 +266,11 @@
         {   return  this->_dims ;
         }
 
+        __inline_call iptr_type      & cpus (
+            )
+        {   return  this->_cpus ;
+        }
+
         __inline_call real_type      & siz1 (
             )
         {   return  this->_siz1 ;
@@ -379,6 +388,11 @@
         {   return  this->_dims ;
         }
 
+        __inline_call iptr_type const& cpus (
+            ) const
+        {   return  this->_cpus ;
+        }
+
         __inline_call real_type const& siz1 (
             ) const
         {   return  this->_siz1 ;
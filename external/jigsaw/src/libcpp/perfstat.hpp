@@ -0,0 +1,276 @@
+    /*
+    --------------------------------------------------------
+     * PERFSTAT: hot-path counters + timings.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 18 October, 2026
+     *
+     * Copyright 2013-2020
+     * Darren Engwirda
+     * d.engwirda@gmail.com
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __PERFSTAT__
+#   define __PERFSTAT__
+
+#   include <atomic>
+#   include <cstddef>
+
+    namespace perfstat {
+
+    // Counters are bumped in thread_local storage, so that
+    // the hot paths need no sync. Each || region "folds"
+    // the counts of its threads into the global totals on
+    // exit, the caller's thread is folded on demand. The
+    // alloc. byte counts are shared atomics instead, as a
+    // peak is only meaningful over all threads.
+    // Nothing is counted unless a run has called START,
+    // (i.e. a STAT_FILE is set): the hot paths just test
+    // ACTIVE, a plain flag only set in serial code.
+
+    enum _counter {
+    HFUN_EVAL ,                 // h(x) evaluations
+    CAVITY_NUM, CAVITY_SUM,     // rDT cavities, + cells
+    CAVITY_MAX,                 // max. cells per cavity
+    QUEUE_PUSH, QUEUE_POPS,     // priority-queue updates
+    LASTCOUNT } ;
+
+    std::size_t static constexpr ITER_SLOTS = 1024 ;
+    std::size_t static constexpr TIME_SLOTS = +64 ;
+
+    class iter_data
+        {
+        public  :
+        double                  _time = +0. ;
+        std::size_t             _nmov = +0  ;
+        std::size_t             _nflp = +0  ;
+        std::size_t             _nzip = +0  ;
+        std::size_t             _ndiv = +0  ;
+        } ;
+
+    bool        _active = false ;
+
+    thread_local                // counts per thread
+    std::size_t _nn_count[LASTCOUNT] = {0} ;
+
+    std::size_t _tt_count[LASTCOUNT] = {0} ;
+
+    std::atomic<std::ptrdiff_t> _nn_bytes(+0) ;
+    std::atomic<std::ptrdiff_t> _pk_bytes(+0) ;
+
+    iter_data   _tt_iter[ITER_SLOTS] ;
+    std::size_t _nn_iter = +0 ;
+
+    char const* _tt_name[TIME_SLOTS] ;
+    double      _tt_time[TIME_SLOTS] ;
+    std::size_t _nn_time = +0 ;
+
+    /*
+    --------------------------------------------------------
+     * BUMP: add to a per-thread counter.
+    --------------------------------------------------------
+     */
+
+    __inline_call void bump (
+        _counter    _kind ,
+        std::size_t _size = +1
+        )
+    {
+        if (!_active) return ;
+
+        _nn_count[_kind] += _size ;
+    }
+
+    __inline_call void push_cavity (
+        std::size_t _size
+        )
+    {
+        if (!_active) return ;
+
+        _nn_count[CAVITY_NUM] += +1 ;
+        _nn_count[CAVITY_SUM] += _size ;
+
+        if (_nn_count[CAVITY_MAX] < _size)
+            _nn_count[CAVITY_MAX] = _size ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * PUSH/_POP-BYTES: track live + peak alloc.
+    --------------------------------------------------------
+     */
+
+    __inline_call void push_bytes (
+        std::size_t _size
+        )
+    {
+        if (!_active) return ;
+
+        std::ptrdiff_t _live = _nn_bytes.fetch_add(
+            (std::ptrdiff_t)_size,
+                std::memory_order_relaxed) +
+            (std::ptrdiff_t)_size ;
+
+        std::ptrdiff_t _peak =
+            _pk_bytes.load(std::memory_order_relaxed) ;
+
+        while (_live > _peak &&
+           !_pk_bytes.compare_exchange_weak(
+                _peak, _live,
+                std::memory_order_relaxed) ) { }
+    }
+
+    __inline_call void _pop_bytes (
+        std::size_t _size
+        )
+    {
+        if (!_active) return ;
+
+        _nn_bytes.fetch_sub(
+            (std::ptrdiff_t)_size,
+                std::memory_order_relaxed) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * PUSH-ITER/TIME: record iter. + stage timing.
+    --------------------------------------------------------
+     */
+
+    __inline_call void push_iter (
+        iter_data const&_stat
+        )
+    {
+        if (_nn_iter < ITER_SLOTS)
+            _tt_iter[_nn_iter] = _stat ;
+
+        _nn_iter += +1 ;
+    }
+
+    __inline_call void push_time (
+        char const *_name ,
+        double      _time
+        )
+    {
+        if (_nn_time < TIME_SLOTS)
+        {
+            _tt_name[_nn_time] = _name ;
+            _tt_time[_nn_time] = _time ;
+
+            _nn_time += +1 ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * FOLD: add this thread's counts to totals.
+    --------------------------------------------------------
+     */
+
+    __normal_call void fold (
+        )
+    {
+    #   ifdef  __use_openmp
+    #   pragma omp critical(__perfstat_fold)
+    #   endif//__use_openmp
+        {
+        for (auto _kind = +0 ;
+                  _kind < LASTCOUNT; ++_kind)
+        {
+            if (_kind == CAVITY_MAX)
+            {
+            if (_tt_count[_kind] <
+                _nn_count[_kind])
+                _tt_count[_kind] =
+                _nn_count[_kind] ;
+            }
+            else
+            {
+                _tt_count[_kind] +=
+                _nn_count[_kind] ;
+            }
+
+            _nn_count[_kind] = +0 ;
+        }
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * RESET: zero totals before a new run.
+    --------------------------------------------------------
+     */
+
+    __normal_call void reset (
+        )
+    {
+        _active = false ;
+
+        for (auto _kind = +0 ;
+                  _kind < LASTCOUNT; ++_kind)
+        {
+            _nn_count[_kind] = +0 ;
+            _tt_count[_kind] = +0 ;
+        }
+
+        _nn_bytes.store(+0) ;
+        _pk_bytes.store(+0) ;
+
+        _nn_iter = +0 ;
+        _nn_time = +0 ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * START: begin counting, once STAT_FILE is known.
+    --------------------------------------------------------
+     */
+
+    // Alloc. bytes are net of the start: blocks freed
+    // that were alloc.'d before may leave LIVE < 0.
+
+    __inline_call void start (
+        )
+    {
+        _active = true ;
+    }
+
+
+    }
+
+#   endif//__PERFSTAT__
+
+
+
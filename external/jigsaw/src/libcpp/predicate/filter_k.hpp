@@ -0,0 +1,574 @@
+
+    /*
+    --------------------------------------------------------
+     * PREDICATE-k: robust geometric predicates in E^k.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 17 October, 2026
+     *
+     * Copyright 2020--
+     * Darren Engwirda
+     * d.engwirda@gmail.com
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+
+    /*
+    --------------------------------------------------------
+     *
+     * "Semi-static" filters for batches of predicates: the
+     * sign of a float determinant is certified against an
+     * error bound built from the max. abs. coord. diff.'s
+     * of each column, rather than the full permanent of
+     * the "float" kernels. Items are passed as "SoA" data
+     * PP[(INOD * NDIM + IDIM) * NSTR + ITEM], sharing the
+     * last point. Loops are branch-free and unit-stride,
+     * so that they can be vectorised. Each bound is the
+     * "float" tolerance with one extra EPS to cover the
+     * rounding of the bound itself.
+     *
+    --------------------------------------------------------
+     */
+
+#   ifdef  __use_openmp
+#   define __simd_loop _Pragma("omp simd")
+#   else
+#   define __simd_loop
+#   endif//__use_openmp
+
+    __inline_call REAL_TYPE max_s (
+        REAL_TYPE  _aa ,
+        REAL_TYPE  _bb
+        )
+    {   // by-value max., so that loops can be vectorised
+        return _aa > _bb ? _aa : _bb ;
+    }
+
+    __normal_call void_type orient2d_s (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _rr ,
+      __write_ptr(REAL_TYPE) _FT
+        )
+    {
+    /*--------------- orient2d predicate, "semi" version */
+        REAL_TYPE static const _ER =
+        +  5. * std::pow(mp::_epsilon, 1)
+              * (REAL_TYPE)+2. ;
+
+        __const_ptr(REAL_TYPE) _ax = _pp + 0 * _nstr ;
+        __const_ptr(REAL_TYPE) _ay = _pp + 1 * _nstr ;
+        __const_ptr(REAL_TYPE) _bx = _pp + 2 * _nstr ;
+        __const_ptr(REAL_TYPE) _by = _pp + 3 * _nstr ;
+
+        REAL_TYPE const _xc = _pc[0] ;
+        REAL_TYPE const _yc = _pc[1] ;
+
+        __simd_loop
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; ++_ipos)
+        {
+            REAL_TYPE _acx, _acy ;
+            REAL_TYPE _bcx, _bcy ;
+
+            _acx = _ax[_ipos] - _xc ;  // coord. diff.
+            _acy = _ay[_ipos] - _yc ;
+
+            _bcx = _bx[_ipos] - _xc ;
+            _bcy = _by[_ipos] - _yc ;
+
+            REAL_TYPE _MX = max_s(
+                std::abs(_acx), std::abs(_bcx)) ;
+            REAL_TYPE _MY = max_s(
+                std::abs(_acy), std::abs(_bcy)) ;
+
+            _rr[_ipos] =                  // 2 x 2 result
+                _acx * _bcy - _acy * _bcx ;
+
+            _FT[_ipos] =                  // roundoff tol
+                _ER * (_MX * _MY) ;
+        }
+    }
+
+    __normal_call void_type orient3d_s (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _rr ,
+      __write_ptr(REAL_TYPE) _FT
+        )
+    {
+    /*--------------- orient3d predicate, "semi" version */
+        REAL_TYPE static const _ER =
+        +  9. * std::pow(mp::_epsilon, 1)
+              * (REAL_TYPE)+6. ;
+
+        __const_ptr(REAL_TYPE) _ax = _pp + 0 * _nstr ;
+        __const_ptr(REAL_TYPE) _ay = _pp + 1 * _nstr ;
+        __const_ptr(REAL_TYPE) _az = _pp + 2 * _nstr ;
+        __const_ptr(REAL_TYPE) _bx = _pp + 3 * _nstr ;
+        __const_ptr(REAL_TYPE) _by = _pp + 4 * _nstr ;
+        __const_ptr(REAL_TYPE) _bz = _pp + 5 * _nstr ;
+        __const_ptr(REAL_TYPE) _cx = _pp + 6 * _nstr ;
+        __const_ptr(REAL_TYPE) _cy = _pp + 7 * _nstr ;
+        __const_ptr(REAL_TYPE) _cz = _pp + 8 * _nstr ;
+
+        REAL_TYPE const _xd = _pd[0] ;
+        REAL_TYPE const _yd = _pd[1] ;
+        REAL_TYPE const _zd = _pd[2] ;
+
+        __simd_loop
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; ++_ipos)
+        {
+            REAL_TYPE _adx, _ady, _adz ,
+                      _bdx, _bdy, _bdz ,
+                      _cdx, _cdy, _cdz ;
+
+            _adx = _ax[_ipos] - _xd ;  // coord. diff.
+            _ady = _ay[_ipos] - _yd ;
+            _adz = _az[_ipos] - _zd ;
+
+            _bdx = _bx[_ipos] - _xd ;
+            _bdy = _by[_ipos] - _yd ;
+            _bdz = _bz[_ipos] - _zd ;
+
+            _cdx = _cx[_ipos] - _xd ;
+            _cdy = _cy[_ipos] - _yd ;
+            _cdz = _cz[_ipos] - _zd ;
+
+            REAL_TYPE _MX = max_s(max_s(
+                std::abs(_adx), std::abs(_bdx)),
+                std::abs(_cdx)) ;
+            REAL_TYPE _MY = max_s(max_s(
+                std::abs(_ady), std::abs(_bdy)),
+                std::abs(_cdy)) ;
+            REAL_TYPE _MZ = max_s(max_s(
+                std::abs(_adz), std::abs(_bdz)),
+                std::abs(_cdz)) ;
+
+            _rr[_ipos] =                  // 3 x 3 result
+              _adz * (_bdx * _cdy - _cdx * _bdy)
+            + _bdz * (_cdx * _ady - _adx * _cdy)
+            + _cdz * (_adx * _bdy - _bdx * _ady) ;
+
+            _FT[_ipos] =                  // roundoff tol
+                _ER * (_MZ * (_MX * _MY)) ;
+        }
+    }
+
+    __normal_call void_type inball2d_s (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _rr ,
+      __write_ptr(REAL_TYPE) _FT
+        )
+    {
+    /*--------------- inball2d predicate, "semi" version */
+        REAL_TYPE static const _ER =
+        + 12. * std::pow(mp::_epsilon, 1)
+              * (REAL_TYPE)+6. ;
+
+        __const_ptr(REAL_TYPE) _ax = _pp + 0 * _nstr ;
+        __const_ptr(REAL_TYPE) _ay = _pp + 1 * _nstr ;
+        __const_ptr(REAL_TYPE) _bx = _pp + 2 * _nstr ;
+        __const_ptr(REAL_TYPE) _by = _pp + 3 * _nstr ;
+        __const_ptr(REAL_TYPE) _cx = _pp + 4 * _nstr ;
+        __const_ptr(REAL_TYPE) _cy = _pp + 5 * _nstr ;
+
+        REAL_TYPE const _xd = _pd[0] ;
+        REAL_TYPE const _yd = _pd[1] ;
+
+        __simd_loop
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; ++_ipos)
+        {
+            REAL_TYPE _adx, _ady, _ali ,
+                      _bdx, _bdy, _bli ,
+                      _cdx, _cdy, _cli ;
+
+            _adx = _ax[_ipos] - _xd ;  // coord. diff.
+            _ady = _ay[_ipos] - _yd ;
+
+            _bdx = _bx[_ipos] - _xd ;
+            _bdy = _by[_ipos] - _yd ;
+
+            _cdx = _cx[_ipos] - _xd ;
+            _cdy = _cy[_ipos] - _yd ;
+
+            _ali = _adx * _adx + _ady * _ady ;
+            _bli = _bdx * _bdx + _bdy * _bdy ;
+            _cli = _cdx * _cdx + _cdy * _cdy ;
+
+            REAL_TYPE _MX = max_s(max_s(
+                std::abs(_adx), std::abs(_bdx)),
+                std::abs(_cdx)) ;
+            REAL_TYPE _MY = max_s(max_s(
+                std::abs(_ady), std::abs(_bdy)),
+                std::abs(_cdy)) ;
+            REAL_TYPE _LI = max_s(max_s(
+                _ali, _bli), _cli) ;
+
+            _rr[_ipos] =                  // 3 x 3 result
+              _ali * (_bdx * _cdy - _cdx * _bdy)
+            + _bli * (_cdx * _ady - _adx * _cdy)
+            + _cli * (_adx * _bdy - _bdx * _ady) ;
+
+            _FT[_ipos] =                  // roundoff tol
+                _ER * (_LI * (_MX * _MY)) ;
+        }
+    }
+
+    __normal_call void_type inball2w_s (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _rr ,
+      __write_ptr(REAL_TYPE) _FT
+        )
+    {
+    /*--------------- inball2w predicate, "semi" version */
+        REAL_TYPE static const _ER =
+        + 13. * std::pow(mp::_epsilon, 1)
+              * (REAL_TYPE)+6. ;
+
+        __const_ptr(REAL_TYPE) _ax = _pp + 0 * _nstr ;
+        __const_ptr(REAL_TYPE) _ay = _pp + 1 * _nstr ;
+        __const_ptr(REAL_TYPE) _aw = _pp + 2 * _nstr ;
+        __const_ptr(REAL_TYPE) _bx = _pp + 3 * _nstr ;
+        __const_ptr(REAL_TYPE) _by = _pp + 4 * _nstr ;
+        __const_ptr(REAL_TYPE) _bw = _pp + 5 * _nstr ;
+        __const_ptr(REAL_TYPE) _cx = _pp + 6 * _nstr ;
+        __const_ptr(REAL_TYPE) _cy = _pp + 7 * _nstr ;
+        __const_ptr(REAL_TYPE) _cw = _pp + 8 * _nstr ;
+
+        REAL_TYPE const _xd = _pd[0] ;
+        REAL_TYPE const _yd = _pd[1] ;
+        REAL_TYPE const _zd = _pd[2] ;
+
+        __simd_loop
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; ++_ipos)
+        {
+            REAL_TYPE _adx, _ady, _ali ,
+                      _bdx, _bdy, _bli ,
+                      _cdx, _cdy, _cli ;
+
+            _adx = _ax[_ipos] - _xd ;  // coord. diff.
+            _ady = _ay[_ipos] - _yd ;
+
+            _bdx = _bx[_ipos] - _xd ;
+            _bdy = _by[_ipos] - _yd ;
+
+            _cdx = _cx[_ipos] - _xd ;
+            _cdy = _cy[_ipos] - _yd ;
+
+            _ali = _adx * _adx + _ady * _ady
+                 - (_aw[_ipos] - _zd) ;
+            _bli = _bdx * _bdx + _bdy * _bdy
+                 - (_bw[_ipos] - _zd) ;
+            _cli = _cdx * _cdx + _cdy * _cdy
+                 - (_cw[_ipos] - _zd) ;
+
+            REAL_TYPE _MX = max_s(max_s(
+                std::abs(_adx), std::abs(_bdx)),
+                std::abs(_cdx)) ;
+            REAL_TYPE _MY = max_s(max_s(
+                std::abs(_ady), std::abs(_bdy)),
+                std::abs(_cdy)) ;
+            REAL_TYPE _LI = max_s(max_s(
+                std::abs(_ali), std::abs(_bli)),
+                std::abs(_cli)) ;
+
+            _rr[_ipos] =                  // 3 x 3 result
+              _ali * (_bdx * _cdy - _cdx * _bdy)
+            + _bli * (_cdx * _ady - _adx * _cdy)
+            + _cli * (_adx * _bdy - _bdx * _ady) ;
+
+            _FT[_ipos] =                  // roundoff tol
+                _ER * (_LI * (_MX * _MY)) ;
+        }
+    }
+
+    __normal_call void_type inball3d_s (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __write_ptr(REAL_TYPE) _rr ,
+      __write_ptr(REAL_TYPE) _FT
+        )
+    {
+    /*--------------- inball3d predicate, "semi" version */
+        REAL_TYPE static const _ER =
+        + 18. * std::pow(mp::_epsilon, 1)
+              * (REAL_TYPE)+24. ;
+
+        __const_ptr(REAL_TYPE) _ax = _pp + 0 * _nstr ;
+        __const_ptr(REAL_TYPE) _ay = _pp + 1 * _nstr ;
+        __const_ptr(REAL_TYPE) _az = _pp + 2 * _nstr ;
+        __const_ptr(REAL_TYPE) _bx = _pp + 3 * _nstr ;
+        __const_ptr(REAL_TYPE) _by = _pp + 4 * _nstr ;
+        __const_ptr(REAL_TYPE) _bz = _pp + 5 * _nstr ;
+        __const_ptr(REAL_TYPE) _cx = _pp + 6 * _nstr ;
+        __const_ptr(REAL_TYPE) _cy = _pp + 7 * _nstr ;
+        __const_ptr(REAL_TYPE) _cz = _pp + 8 * _nstr ;
+        __const_ptr(REAL_TYPE) _dx = _pp + 9 * _nstr ;
+        __const_ptr(REAL_TYPE) _dy = _pp +10 * _nstr ;
+        __const_ptr(REAL_TYPE) _dz = _pp +11 * _nstr ;
+
+        REAL_TYPE const _xe = _pe[0] ;
+        REAL_TYPE const _ye = _pe[1] ;
+        REAL_TYPE const _ze = _pe[2] ;
+
+        __simd_loop
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; ++_ipos)
+        {
+            REAL_TYPE _aex, _aey, _aez, _ali,
+                      _bex, _bey, _bez, _bli,
+                      _cex, _cey, _cez, _cli,
+                      _dex, _dey, _dez, _dli;
+            REAL_TYPE _ab_, _bc_, _cd_, _da_,
+                      _ac_, _bd_;
+            REAL_TYPE _abc, _bcd, _cda, _dab;
+
+            _aex = _ax[_ipos] - _xe ;  // coord. diff.
+            _aey = _ay[_ipos] - _ye ;
+            _aez = _az[_ipos] - _ze ;
+
+            _bex = _bx[_ipos] - _xe ;
+            _bey = _by[_ipos] - _ye ;
+            _bez = _bz[_ipos] - _ze ;
+
+            _cex = _cx[_ipos] - _xe ;
+            _cey = _cy[_ipos] - _ye ;
+            _cez = _cz[_ipos] - _ze ;
+
+            _dex = _dx[_ipos] - _xe ;
+            _dey = _dy[_ipos] - _ye ;
+            _dez = _dz[_ipos] - _ze ;
+
+            _ali = _aex * _aex + _aey * _aey
+                 + _aez * _aez ;
+            _bli = _bex * _bex + _bey * _bey
+                 + _bez * _bez ;
+            _cli = _cex * _cex + _cey * _cey
+                 + _cez * _cez ;
+            _dli = _dex * _dex + _dey * _dey
+                 + _dez * _dez ;
+
+            REAL_TYPE _MX = max_s(
+                max_s(std::abs(_aex),
+                         std::abs(_bex)),
+                max_s(std::abs(_cex),
+                         std::abs(_dex))) ;
+            REAL_TYPE _MY = max_s(
+                max_s(std::abs(_aey),
+                         std::abs(_bey)),
+                max_s(std::abs(_cey),
+                         std::abs(_dey))) ;
+            REAL_TYPE _MZ = max_s(
+                max_s(std::abs(_aez),
+                         std::abs(_bez)),
+                max_s(std::abs(_cez),
+                         std::abs(_dez))) ;
+            REAL_TYPE _LI = max_s(
+                max_s(_ali, _bli),
+                max_s(_cli, _dli)) ;
+
+            _ab_ = _aex * _bey - _bex * _aey ;
+            _bc_ = _bex * _cey - _cex * _bey ;
+            _cd_ = _cex * _dey - _dex * _cey ;
+            _da_ = _dex * _aey - _aex * _dey ;
+            _ac_ = _aex * _cey - _cex * _aey ;
+            _bd_ = _bex * _dey - _dex * _bey ;
+
+            _abc =                        // 3 x 3 minors
+              _aez * _bc_ - _bez * _ac_
+            + _cez * _ab_ ;
+            _bcd =
+              _bez * _cd_ - _cez * _bd_
+            + _dez * _bc_ ;
+            _cda =
+              _cez * _da_ + _dez * _ac_
+            + _aez * _cd_ ;
+            _dab =
+              _dez * _ab_ + _aez * _bd_
+            + _bez * _da_ ;
+
+            _rr[_ipos] =                  // 4 x 4 result
+              _dli * _abc - _cli * _dab
+            + _bli * _cda - _ali * _bcd ;
+
+            _FT[_ipos] =                  // roundoff tol
+                _ER * (_LI * (_MZ * (_MX * _MY))) ;
+        }
+    }
+
+    __normal_call void_type inball3w_s (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __write_ptr(REAL_TYPE) _rr ,
+      __write_ptr(REAL_TYPE) _FT
+        )
+    {
+    /*--------------- inball3w predicate, "semi" version */
+        REAL_TYPE static const _ER =
+        + 19. * std::pow(mp::_epsilon, 1)
+              * (REAL_TYPE)+24. ;
+
+        __const_ptr(REAL_TYPE) _ax = _pp + 0 * _nstr ;
+        __const_ptr(REAL_TYPE) _ay = _pp + 1 * _nstr ;
+        __const_ptr(REAL_TYPE) _az = _pp + 2 * _nstr ;
+        __const_ptr(REAL_TYPE) _aw = _pp + 3 * _nstr ;
+        __const_ptr(REAL_TYPE) _bx = _pp + 4 * _nstr ;
+        __const_ptr(REAL_TYPE) _by = _pp + 5 * _nstr ;
+        __const_ptr(REAL_TYPE) _bz = _pp + 6 * _nstr ;
+        __const_ptr(REAL_TYPE) _bw = _pp + 7 * _nstr ;
+        __const_ptr(REAL_TYPE) _cx = _pp + 8 * _nstr ;
+        __const_ptr(REAL_TYPE) _cy = _pp + 9 * _nstr ;
+        __const_ptr(REAL_TYPE) _cz = _pp +10 * _nstr ;
+        __const_ptr(REAL_TYPE) _cw = _pp +11 * _nstr ;
+        __const_ptr(REAL_TYPE) _dx = _pp +12 * _nstr ;
+        __const_ptr(REAL_TYPE) _dy = _pp +13 * _nstr ;
+        __const_ptr(REAL_TYPE) _dz = _pp +14 * _nstr ;
+        __const_ptr(REAL_TYPE) _dw = _pp +15 * _nstr ;
+
+        REAL_TYPE const _xe = _pe[0] ;
+        REAL_TYPE const _ye = _pe[1] ;
+        REAL_TYPE const _ze = _pe[2] ;
+        REAL_TYPE const _we = _pe[3] ;
+
+        __simd_loop
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; ++_ipos)
+        {
+            REAL_TYPE _aex, _aey, _aez, _ali,
+                      _bex, _bey, _bez, _bli,
+                      _cex, _cey, _cez, _cli,
+                      _dex, _dey, _dez, _dli;
+            REAL_TYPE _ab_, _bc_, _cd_, _da_,
+                      _ac_, _bd_;
+            REAL_TYPE _abc, _bcd, _cda, _dab;
+
+            _aex = _ax[_ipos] - _xe ;  // coord. diff.
+            _aey = _ay[_ipos] - _ye ;
+            _aez = _az[_ipos] - _ze ;
+
+            _bex = _bx[_ipos] - _xe ;
+            _bey = _by[_ipos] - _ye ;
+            _bez = _bz[_ipos] - _ze ;
+
+            _cex = _cx[_ipos] - _xe ;
+            _cey = _cy[_ipos] - _ye ;
+            _cez = _cz[_ipos] - _ze ;
+
+            _dex = _dx[_ipos] - _xe ;
+            _dey = _dy[_ipos] - _ye ;
+            _dez = _dz[_ipos] - _ze ;
+
+            _ali = _aex * _aex + _aey * _aey
+                 + _aez * _aez
+                 - (_aw[_ipos] - _we) ;
+            _bli = _bex * _bex + _bey * _bey
+                 + _bez * _bez
+                 - (_bw[_ipos] - _we) ;
+            _cli = _cex * _cex + _cey * _cey
+                 + _cez * _cez
+                 - (_cw[_ipos] - _we) ;
+            _dli = _dex * _dex + _dey * _dey
+                 + _dez * _dez
+                 - (_dw[_ipos] - _we) ;
+
+            REAL_TYPE _MX = max_s(
+                max_s(std::abs(_aex),
+                         std::abs(_bex)),
+                max_s(std::abs(_cex),
+                         std::abs(_dex))) ;
+            REAL_TYPE _MY = max_s(
+                max_s(std::abs(_aey),
+                         std::abs(_bey)),
+                max_s(std::abs(_cey),
+                         std::abs(_dey))) ;
+            REAL_TYPE _MZ = max_s(
+                max_s(std::abs(_aez),
+                         std::abs(_bez)),
+                max_s(std::abs(_cez),
+                         std::abs(_dez))) ;
+            REAL_TYPE _LI = max_s(
+                max_s(std::abs(_ali),
+                         std::abs(_bli)),
+                max_s(std::abs(_cli),
+                         std::abs(_dli))) ;
+
+            _ab_ = _aex * _bey - _bex * _aey ;
+            _bc_ = _bex * _cey - _cex * _bey ;
+            _cd_ = _cex * _dey - _dex * _cey ;
+            _da_ = _dex * _aey - _aex * _dey ;
+            _ac_ = _aex * _cey - _cex * _aey ;
+            _bd_ = _bex * _dey - _dex * _bey ;
+
+            _abc =                        // 3 x 3 minors
+              _aez * _bc_ - _bez * _ac_
+            + _cez * _ab_ ;
+            _bcd =
+              _bez * _cd_ - _cez * _bd_
+            + _dez * _bc_ ;
+            _cda =
+              _cez * _da_ + _dez * _ac_
+            + _aez * _cd_ ;
+            _dab =
+              _dez * _ab_ + _aez * _bd_
+            + _bez * _da_ ;
+
+            _rr[_ipos] =                  // 4 x 4 result
+              _dli * _abc - _cli * _dab
+            + _bli * _cda - _ali * _bcd ;
+
+            _FT[_ipos] =                  // roundoff tol
+                _ER * (_LI * (_MZ * (_MX * _MY))) ;
+        }
+    }
+
+#   undef  __simd_loop
+
+
+
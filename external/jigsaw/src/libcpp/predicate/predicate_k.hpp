@@ -97,14 +97,70 @@
     INBALL3W_f, INBALL3W_i, INBALL3W_e ,
     INBALL4D_f, INBALL4D_i, INBALL4D_e ,
     INBALL4W_f, INBALL4W_i, INBALL4W_e ,
+    ORIENT2D_s, ORIENT3D_s,
+    INBALL2D_s, INBALL2W_s,
+    INBALL3D_s, INBALL3W_s,
     LASTKERNEL } ;
 
+    thread_local                // counts per thread
     size_t _nn_calls[LASTKERNEL] = {0} ;
 
+    size_t _tt_calls[LASTKERNEL] = {0} ;
+
+    char const *_nm_calls[LASTKERNEL] = {
+    "orient2d-f", "orient2d-i", "orient2d-e",
+    "orient3d-f", "orient3d-i", "orient3d-e",
+    "orient4d-f", "orient4d-i", "orient4d-e",
+    "bisect2d-f", "bisect2d-i", "bisect2d-e",
+    "bisect2w-f", "bisect2w-i", "bisect2w-e",
+    "bisect3d-f", "bisect3d-i", "bisect3d-e",
+    "bisect3w-f", "bisect3w-i", "bisect3w-e",
+    "bisect4d-f", "bisect4d-i", "bisect4d-e",
+    "bisect4w-f", "bisect4w-i", "bisect4w-e",
+    "inball2d-f", "inball2d-i", "inball2d-e",
+    "inball2w-f", "inball2w-i", "inball2w-e",
+    "inball3d-f", "inball3d-i", "inball3d-e",
+    "inball3w-f", "inball3w-i", "inball3w-e",
+    "inball4d-f", "inball4d-i", "inball4d-e",
+    "inball4w-f", "inball4w-i", "inball4w-e",
+    "orient2d-s", "orient3d-s",
+    "inball2d-s", "inball2w-s",
+    "inball3d-s", "inball3w-s" } ;
+
+    /*------------ add this thread's counts to the totals */
+
+    __normal_call void fold_calls (
+        )
+    {
+    #   ifdef  __use_openmp
+    #   pragma omp critical(__geompred_fold)
+    #   endif//__use_openmp
+        {
+        for (auto _kern = +0 ;
+                  _kern < LASTKERNEL; ++_kern)
+        {
+            _tt_calls[_kern] += _nn_calls[_kern] ;
+            _nn_calls[_kern]  = +0 ;
+        }
+        }
+    }
+
+    __normal_call void zero_calls (
+        )
+    {
+        for (auto _kern = +0 ;
+                  _kern < LASTKERNEL; ++_kern)
+        {
+            _tt_calls[_kern] = +0 ;
+            _nn_calls[_kern] = +0 ;
+        }
+    }
+
 #   include "orient_k.hpp"
 #   include "bisect_k.hpp"
 //  include "linear_k.hpp"
 #   include "inball_k.hpp"
+#   include "filter_k.hpp"
 
     __inline_call REAL_TYPE orient2d (
       __const_ptr(REAL_TYPE) _pa ,
@@ -705,6 +761,381 @@
         }
     }
 
+
+    /*
+    --------------------------------------------------------
+     * Batched predicates: evaluate a "semi-static" filter
+     * over blocks of items, re-computing only uncertified
+     * signs via the full (float-bound-exact) sequence.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type orient2d (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pc ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ orient2d predicate, "batched" version */
+        INDX_TYPE static const _BLOCK = +32 ;
+
+        REAL_TYPE _FT[_BLOCK] ;
+        REAL_TYPE _pa[2] ;
+        REAL_TYPE _pb[2] ;
+
+        _nn_calls[ORIENT2D_s] += _nnum;
+
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; _ipos += _BLOCK)
+        {
+            INDX_TYPE _inum =
+                std::min(_BLOCK, _nnum - _ipos) ;
+
+            orient2d_s(                  // "semi" kernel
+                _inum, _pp + _ipos, _nstr, _pc,
+                _rr + _ipos, _FT ) ;
+
+            for (INDX_TYPE _item = +0 ;
+                    _item < _inum; ++_item)
+            {
+            REAL_TYPE _sgn = _rr[_ipos + _item] ;
+
+            if (std::abs(_sgn) > _FT[_item] &&
+                    std::isnormal(_sgn)) continue ;
+
+            INDX_TYPE _iitm = _ipos + _item ;
+
+        /*------------ uncertified: redo via full sequence */
+
+            for (auto _idim = +0 ;
+                      _idim < 2; ++_idim)
+            _pa[_idim] =
+                _pp[(0 * 2 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 2; ++_idim)
+            _pb[_idim] =
+                _pp[(1 * 2 + _idim) * _nstr + _iitm] ;
+
+            _rr[_iitm] = orient2d( _pa, _pb, _pc ) ;
+            }
+        }
+    }
+
+    __normal_call void_type orient3d (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ orient3d predicate, "batched" version */
+        INDX_TYPE static const _BLOCK = +32 ;
+
+        REAL_TYPE _FT[_BLOCK] ;
+        REAL_TYPE _pa[3] ;
+        REAL_TYPE _pb[3] ;
+        REAL_TYPE _pc[3] ;
+
+        _nn_calls[ORIENT3D_s] += _nnum;
+
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; _ipos += _BLOCK)
+        {
+            INDX_TYPE _inum =
+                std::min(_BLOCK, _nnum - _ipos) ;
+
+            orient3d_s(                  // "semi" kernel
+                _inum, _pp + _ipos, _nstr, _pd,
+                _rr + _ipos, _FT ) ;
+
+            for (INDX_TYPE _item = +0 ;
+                    _item < _inum; ++_item)
+            {
+            REAL_TYPE _sgn = _rr[_ipos + _item] ;
+
+            if (std::abs(_sgn) > _FT[_item] &&
+                    std::isnormal(_sgn)) continue ;
+
+            INDX_TYPE _iitm = _ipos + _item ;
+
+        /*------------ uncertified: redo via full sequence */
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pa[_idim] =
+                _pp[(0 * 3 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pb[_idim] =
+                _pp[(1 * 3 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pc[_idim] =
+                _pp[(2 * 3 + _idim) * _nstr + _iitm] ;
+
+            _rr[_iitm] = orient3d( _pa, _pb, _pc, _pd ) ;
+            }
+        }
+    }
+
+    __normal_call void_type inball2d (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ inball2d predicate, "batched" version */
+        INDX_TYPE static const _BLOCK = +32 ;
+
+        REAL_TYPE _FT[_BLOCK] ;
+        REAL_TYPE _pa[2] ;
+        REAL_TYPE _pb[2] ;
+        REAL_TYPE _pc[2] ;
+
+        _nn_calls[INBALL2D_s] += _nnum;
+
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; _ipos += _BLOCK)
+        {
+            INDX_TYPE _inum =
+                std::min(_BLOCK, _nnum - _ipos) ;
+
+            inball2d_s(                  // "semi" kernel
+                _inum, _pp + _ipos, _nstr, _pd,
+                _rr + _ipos, _FT ) ;
+
+            for (INDX_TYPE _item = +0 ;
+                    _item < _inum; ++_item)
+            {
+            REAL_TYPE _sgn = _rr[_ipos + _item] ;
+
+            if (std::abs(_sgn) > _FT[_item] &&
+                    std::isnormal(_sgn)) continue ;
+
+            INDX_TYPE _iitm = _ipos + _item ;
+
+        /*------------ uncertified: redo via full sequence */
+
+            for (auto _idim = +0 ;
+                      _idim < 2; ++_idim)
+            _pa[_idim] =
+                _pp[(0 * 2 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 2; ++_idim)
+            _pb[_idim] =
+                _pp[(1 * 2 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 2; ++_idim)
+            _pc[_idim] =
+                _pp[(2 * 2 + _idim) * _nstr + _iitm] ;
+
+            _rr[_iitm] = inball2d( _pa, _pb, _pc, _pd ) ;
+            }
+        }
+    }
+
+    __normal_call void_type inball2w (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pd ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ inball2w predicate, "batched" version */
+        INDX_TYPE static const _BLOCK = +32 ;
+
+        REAL_TYPE _FT[_BLOCK] ;
+        REAL_TYPE _pa[3] ;
+        REAL_TYPE _pb[3] ;
+        REAL_TYPE _pc[3] ;
+
+        _nn_calls[INBALL2W_s] += _nnum;
+
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; _ipos += _BLOCK)
+        {
+            INDX_TYPE _inum =
+                std::min(_BLOCK, _nnum - _ipos) ;
+
+            inball2w_s(                  // "semi" kernel
+                _inum, _pp + _ipos, _nstr, _pd,
+                _rr + _ipos, _FT ) ;
+
+            for (INDX_TYPE _item = +0 ;
+                    _item < _inum; ++_item)
+            {
+            REAL_TYPE _sgn = _rr[_ipos + _item] ;
+
+            if (std::abs(_sgn) > _FT[_item] &&
+                    std::isnormal(_sgn)) continue ;
+
+            INDX_TYPE _iitm = _ipos + _item ;
+
+        /*------------ uncertified: redo via full sequence */
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pa[_idim] =
+                _pp[(0 * 3 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pb[_idim] =
+                _pp[(1 * 3 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pc[_idim] =
+                _pp[(2 * 3 + _idim) * _nstr + _iitm] ;
+
+            _rr[_iitm] = inball2w( _pa, _pb, _pc, _pd ) ;
+            }
+        }
+    }
+
+    __normal_call void_type inball3d (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ inball3d predicate, "batched" version */
+        INDX_TYPE static const _BLOCK = +32 ;
+
+        REAL_TYPE _FT[_BLOCK] ;
+        REAL_TYPE _pa[3] ;
+        REAL_TYPE _pb[3] ;
+        REAL_TYPE _pc[3] ;
+        REAL_TYPE _pd[3] ;
+
+        _nn_calls[INBALL3D_s] += _nnum;
+
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; _ipos += _BLOCK)
+        {
+            INDX_TYPE _inum =
+                std::min(_BLOCK, _nnum - _ipos) ;
+
+            inball3d_s(                  // "semi" kernel
+                _inum, _pp + _ipos, _nstr, _pe,
+                _rr + _ipos, _FT ) ;
+
+            for (INDX_TYPE _item = +0 ;
+                    _item < _inum; ++_item)
+            {
+            REAL_TYPE _sgn = _rr[_ipos + _item] ;
+
+            if (std::abs(_sgn) > _FT[_item] &&
+                    std::isnormal(_sgn)) continue ;
+
+            INDX_TYPE _iitm = _ipos + _item ;
+
+        /*------------ uncertified: redo via full sequence */
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pa[_idim] =
+                _pp[(0 * 3 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pb[_idim] =
+                _pp[(1 * 3 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pc[_idim] =
+                _pp[(2 * 3 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 3; ++_idim)
+            _pd[_idim] =
+                _pp[(3 * 3 + _idim) * _nstr + _iitm] ;
+
+            _rr[_iitm] = inball3d( _pa, _pb, _pc, _pd, _pe ) ;
+            }
+        }
+    }
+
+    __normal_call void_type inball3w (
+        INDX_TYPE  _nnum ,
+      __const_ptr(REAL_TYPE) _pp ,
+        INDX_TYPE  _nstr ,
+      __const_ptr(REAL_TYPE) _pe ,
+      __write_ptr(REAL_TYPE) _rr
+        )
+    {
+    /*------------ inball3w predicate, "batched" version */
+        INDX_TYPE static const _BLOCK = +32 ;
+
+        REAL_TYPE _FT[_BLOCK] ;
+        REAL_TYPE _pa[4] ;
+        REAL_TYPE _pb[4] ;
+        REAL_TYPE _pc[4] ;
+        REAL_TYPE _pd[4] ;
+
+        _nn_calls[INBALL3W_s] += _nnum;
+
+        for (INDX_TYPE _ipos = +0 ;
+                _ipos < _nnum; _ipos += _BLOCK)
+        {
+            INDX_TYPE _inum =
+                std::min(_BLOCK, _nnum - _ipos) ;
+
+            inball3w_s(                  // "semi" kernel
+                _inum, _pp + _ipos, _nstr, _pe,
+                _rr + _ipos, _FT ) ;
+
+            for (INDX_TYPE _item = +0 ;
+                    _item < _inum; ++_item)
+            {
+            REAL_TYPE _sgn = _rr[_ipos + _item] ;
+
+            if (std::abs(_sgn) > _FT[_item] &&
+                    std::isnormal(_sgn)) continue ;
+
+            INDX_TYPE _iitm = _ipos + _item ;
+
+        /*------------ uncertified: redo via full sequence */
+
+            for (auto _idim = +0 ;
+                      _idim < 4; ++_idim)
+            _pa[_idim] =
+                _pp[(0 * 4 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 4; ++_idim)
+            _pb[_idim] =
+                _pp[(1 * 4 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 4; ++_idim)
+            _pc[_idim] =
+                _pp[(2 * 4 + _idim) * _nstr + _iitm] ;
+
+            for (auto _idim = +0 ;
+                      _idim < 4; ++_idim)
+            _pd[_idim] =
+                _pp[(3 * 4 + _idim) * _nstr + _iitm] ;
+
+            _rr[_iitm] = inball3w( _pa, _pb, _pc, _pd, _pe ) ;
+            }
+        }
+    }
+
 #   undef REAL_TYPE
 #   undef INDX_TYPE
 
@@ -962,6 +962,95 @@
         }
     }
 
+    /*
+    --------------------------------------------------------
+     * NODE-HVAL: cached size-fun. value at node.
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  hfun_type
+             >
+    __static_call
+    __inline_call real_type node_hval (
+        hfun_type &_hfun,
+        mesh_type &_mesh,
+        iptr_type  _npos
+        )
+    {
+    /*------------ nodes don't move, so H(x) is evaluated
+     * once and kept on the node, unless it is still < 0.
+     */
+        auto _node = _mesh._tria.node(_npos) ;
+
+        if (_node->hval() < (real_type)+0.)
+        {
+            _node->hval() = _hfun.eval (
+                &_node->pval(0), _node->idxh()) ;
+        }
+
+        return _node->hval() ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * FILL-HVAL: batch size-fun. for a scan of new cells.
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  hfun_type ,
+        typename  list_type
+             >
+    __static_call
+    __normal_call void_type fill_hval (
+        hfun_type &_hfun,
+        mesh_type &_mesh,
+        list_type &_tnew,
+        bool_type  _ball
+        )
+    {
+    /*------------ gather H(x) queries for the nodes of the
+     * cells in TNEW that are not yet cached, and (if BALL)
+     * for their circumcentres, evaluating them in batch.
+     * Nodes are flagged as queued with HVAL = 0.
+     */
+        hfun_query_k <
+            hfun_type, +3, +64 > _hbuf(_hfun) ;
+
+        for (auto _iter  = _tnew.head() ;
+                  _iter != _tnew.tend() ;
+                ++_iter  )
+        {
+            auto _tria =
+                _mesh._tria.tria(*_iter) ;
+
+            for (auto _npos = +4; _npos-- != +0; )
+            {
+            auto _node = _mesh.
+                _tria.node(_tria->node(_npos)) ;
+
+            if (_node->hval() < (real_type)+0.)
+            {
+                _node->hval() = (real_type)+0. ;
+
+                _hbuf.push( &_node->pval(0),
+                    _node->idxh(), _node->hval()) ;
+            }
+            }
+
+            if (_ball)
+            {
+                _hbuf.push_copy(&_tria->circ(0),
+                    _mesh._tria.node(
+                    _tria->node(0))->idxh(),
+                    _tria->hval()) ;
+            }
+        }
+
+        _hbuf.flush() ;
+    }
+
     } ;
 
 
@@ -73,6 +73,8 @@
         {
         public  :
     /*---------------------------- delaunay-tri node type */
+            real_type     _hval ;
+
             iptr_type     _idxh ;
             iptr_type     _part ;
 
@@ -93,6 +95,16 @@
         {
             return  this->_idxh ;
         }
+        __inline_call real_type      & hval (
+            )
+        {
+            return  this->_hval ;
+        }
+        __inline_call real_type const& hval (
+            ) const
+        {
+            return  this->_hval ;
+        }
         __inline_call iptr_type      & part (
             )
         {
@@ -141,6 +153,8 @@
     /*---------------------------- delaunay-tri tria type */
             real_type    _circ[  +3] ;
 
+            real_type    _hval ;
+
         public  :
 
         __inline_call real_type      & circ (
@@ -155,6 +169,16 @@
         {
             return this->_circ[ _ipos] ;
         }
+        __inline_call real_type      & hval (
+            )
+        {
+            return this->_hval ;
+        }
+        __inline_call real_type const& hval (
+            ) const
+        {
+            return this->_hval ;
+        }
         } ;
 
     typedef mesh::laguerre_tri_euclidean_3  <
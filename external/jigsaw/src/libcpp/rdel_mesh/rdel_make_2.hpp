@@ -409,7 +409,8 @@
     __normal_call void_type init_init (
         init_type &_init,
         geom_type &_geom,
-        mesh_type &_mesh
+        mesh_type &_mesh,
+        rdel_opts &_opts
         )
     {
     /*------------------------------ form insertion order */
@@ -462,47 +463,25 @@
             }
         }
 
-    /*------------------------------ seed mesh from init. */
-        if (_imid > -1)
-        {
-             auto _node =
-           &_init._mesh. node ( _imid) ;
-
-            if (_node->itag () >= +0 )
-                _geom.projector(
-               &_node->pval(0) ,
-                _node->itag () ,
-               &_node->pval(0) ) ;
-
-            iptr_type _npos = -1 ;
-            if (_mesh._tria.push_node(
-               &_node->pval(0) ,
-                _npos, _hint ) )
-            {
+    /*------------------------------ project init. nodes */
+        containers::array<real_type const*> _ppos ;
+        iptr_list _ipos, _npos ;
 
-            _mesh._tria.node
-                (_npos)->fdim() = 0 ;
+        if (_imid > -1) _ipos.push_tail(_imid) ;
 
-            _mesh._tria.node
-                (_npos)->feat()
-                    = _node->feat() ;
-
-            _mesh._tria.node
-                (_npos)->topo() = 2 ;
-
-            _hint = _mesh._tria.
-                node(_npos)->next() ;
-
-            }
-        }
-
-    /*------------------------------ seed mesh from init. */
         for (auto _iter  = _iset.head();
                   _iter != _iset.tend();
                 ++_iter  )
         {
-            if (*_iter == _imid) continue;
+            if (*_iter == _imid) continue ;
 
+            _ipos.push_tail(*_iter) ;
+        }
+
+        for (auto _iter  = _ipos.head();
+                  _iter != _ipos.tend();
+                ++_iter  )
+        {
              auto _node =
            &_init._mesh. node (*_iter) ;
 
@@ -512,26 +491,31 @@
                 _node->itag () ,
                &_node->pval(0) ) ;
 
-            iptr_type _npos = -1 ;
-            if (_mesh._tria.push_node(
-               &_node->pval(0) ,
-                _npos, _hint ) )
-            {
+            _ppos.push_tail(&_node->pval(0)) ;
+        }
+
+    /*------------------------------ seed mesh from init. */
+        _mesh._tria.push_bulk(
+            _ppos, _npos, _hint, _opts.cpus()) ;
+
+        for (auto _iter = +0 ;
+                  _iter != (iptr_type)_npos.count() ;
+                ++_iter  )
+        {
+            if (_npos[_iter] < +0) continue ;
+
+             auto _node =
+           &_init._mesh. node (_ipos[_iter]) ;
 
             _mesh._tria.node
-                (_npos)->fdim() = 0 ;
+                (_npos[_iter])->fdim() = 0 ;
 
             _mesh._tria.node
-                (_npos)->feat()
+                (_npos[_iter])->feat()
                     = _node->feat() ;
 
             _mesh._tria.node
-                (_npos)->topo() = 2 ;
-
-            _hint = _mesh._tria.
-                node(_npos)->next() ;
-
-            }
+                (_npos[_iter])->topo() = 2 ;
         }
     }
 
@@ -543,8 +527,6 @@
         rdel_opts &_opts
         )
     {
-        __unreferenced(_opts) ;
-
     /*------------------------------ initialise mesh bbox */
         real_type _pmin[ 2] ;
         real_type _pmax[ 2] ;
@@ -611,7 +593,7 @@
         _tria.node(+2)->topo() = +0 ;
 
     /*------------------------------ seed mesh from init. */
-        init_init(_init, _geom, _mesh);
+        init_init(_init, _geom, _mesh, _opts);
     }
 
     /*
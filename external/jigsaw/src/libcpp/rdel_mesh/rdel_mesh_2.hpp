@@ -776,6 +776,8 @@
             {
                 _node->idxh()  =
                  hfun_type::null_hint () ;
+
+                _node->hval()  = -1. ;
             }
         }
 
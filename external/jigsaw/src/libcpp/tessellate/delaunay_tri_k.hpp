@@ -190,6 +190,7 @@
     iptr_list                     _npop ;
 
     iptr_list                     _work ;
+    iptr_list                     _scan ;
 
     public  :
 
@@ -398,6 +399,16 @@
 #   include "delaunay_walk_mesh.inc"
 
 
+    /*
+    --------------------------------------------------------
+     * CIRC-FREE: "conflict" trias., without marking.
+     * PUSH-BULK: push node seq., multi-threaded.
+    --------------------------------------------------------
+     */
+
+#   include "delaunay_push_bulk.inc"
+
+
     /*
     --------------------------------------------------------
      * STAR-TRIA-VOID: re-tria. star-shaped cavity.
@@ -428,7 +439,8 @@
             _tset( _asrc),
             _tpop( _asrc),
             _npop( _asrc),
-            _work( _asrc)  {}
+            _work( _asrc),
+            _scan( _asrc)  {}
 
     __inline_call ~delaunay_tri_k (
         )
@@ -454,6 +466,7 @@
         this->_tpop.clear(_alloc) ;
 
         this->_work.clear(_alloc) ;
+        this->_scan.clear(_alloc) ;
 
         this->_fset.clear(_alloc) ;
     }
@@ -586,7 +599,7 @@
         template circ_pred<
              self_type >_pred( _ppos) ;
 
-        scan_tria_list (_elem, +1,
+        scan_circ_list (_elem, +1,
                         _pred, _work) ;
 
     /*---------------------------------- push index lists */
@@ -681,13 +694,15 @@
             self_type> _pred( _ppos) ;
 
         if (_circ == nullptr)
-        scan_tria_list(_elem, +1   ,
+        scan_circ_list(_elem, +1   ,
                        _pred, _work) ;
         else
        _work.push_tail(_circ->head() ,
                        _circ->tend()
                        ) ;
 
+        perfstat::push_cavity(_work.count()) ;
+
         star_tria_void(_work, _node,
                    +1, _tnew, _told) ;
 
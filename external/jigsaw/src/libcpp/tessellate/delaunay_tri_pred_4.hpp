@@ -304,6 +304,22 @@
             */
             return (_sign <= (double)0.0) ;
         }
+
+        __inline_call void_type operator()(
+            mesh_type &_mesh,
+            iptr_type  _tnum,
+            iptr_type const*_tpos,
+            bool_type *_pass
+            ) const
+        {
+    /*------------------------------------ batched ball tests */
+            for (auto _ipos = +0 ;
+                      _ipos < _tnum; ++_ipos)
+            {
+                _pass[_ipos] = (*this)(
+                    _mesh, _tpos[_ipos], +0) ;
+            }
+        }
         } ;
 
     class face_ptrs
@@ -273,6 +273,65 @@
 
             return (_sign <= (double)0.0) ;
         }
+
+        __inline_call void_type operator()(
+            mesh_type &_mesh,
+            iptr_type  _tnum,
+            iptr_type const*_tpos,
+            bool_type *_pass
+            ) const
+        {
+    /*------------------------------------ batched ball tests */
+            iptr_type static constexpr _BUFF = +32 ;
+
+            double _pbuf[4 * 4 * _BUFF] ;
+            double _sign[_BUFF] ;
+
+            double _xpos[4] ;
+            _xpos[0] = this->_ppos[0] ;
+            _xpos[1] = this->_ppos[1] ;
+            _xpos[2] = this->_ppos[2] ;
+            _xpos[3] = this->_ppos[3] ;
+
+            for (auto _ibeg = +0 ;
+                      _ibeg < _tnum; _ibeg += _BUFF)
+            {
+            iptr_type _inum =
+                std::min(_BUFF, _tnum - _ibeg) ;
+
+        /*-------------------- pack nodes as "SoA" blocks */
+            for (auto _ipos = +0 ;
+                      _ipos < _inum; ++_ipos)
+            {
+            for (auto _inod = +0 ;
+                      _inod < 4; ++_inod)
+            {
+                iptr_type _node = _mesh.
+                tria(_tpos[_ibeg + _ipos])->node(_inod) ;
+
+                for (auto _idim = +0 ;
+                          _idim < 4; ++_idim)
+                {
+                _pbuf[(_inod * 4 + _idim)
+                        * _BUFF + _ipos] =
+                    _mesh.node(_node)->pval(_idim) ;
+                }
+            }
+            }
+
+            geompred::inball3w  (
+                _inum, &_pbuf[ 0],
+                _BUFF, &_xpos[ 0],
+                &_sign[ 0] ) ;
+
+            for (auto _ipos = +0 ;
+                      _ipos < _inum; ++_ipos)
+            {
+                _pass[_ibeg + _ipos] =
+                    _sign[_ipos] <= (double)0.0 ;
+            }
+            }
+        }
         } ;
 
     class face_ptrs
@@ -75,15 +75,21 @@
 
     /*------------------------------------- INIT keywords */
         _jcfg->_init_near = (real_t) +1.E-8;
+        _jcfg->_init_keep = (indx_t) +0 ;
+        _jcfg->_init_halo = (indx_t) +2 ;
 
     /*------------------------------------- HFUN keywords */
         _jcfg->_hfun_scal = JIGSAW_HFUN_RELATIVE ;
         _jcfg->_hfun_hmax = (real_t) +0.02 ;
         _jcfg->_hfun_hmin = (real_t) +0.00 ;
 
+        _jcfg->_hfun_clip = JIGSAW_HFUN_MARCHING ;
+        _jcfg->_hfun_cpus = (indx_t) +1 ;
+
     /*------------------------------------- MESH keywords */
         _jcfg->_mesh_kern = JIGSAW_KERN_DELFRONT ;
         _jcfg->_mesh_dims = (indx_t) +3 ;
+        _jcfg->_mesh_cpus = (indx_t) +1 ;
         _jcfg->_mesh_iter = (indx_t)
             std::numeric_limits<iptr_type>::max();
 
@@ -125,6 +131,8 @@
         _jcfg->_optm_dual = (indx_t) +0 ;
         _jcfg->_optm_div_ = (indx_t) +1 ;
         _jcfg->_optm_zip_ = (indx_t) +1 ;
+
+        _jcfg->_optm_cpus = (indx_t) +1 ;
     }
 
 #   endif//__lib_jigsaw
@@ -120,6 +120,20 @@
             this->
            _jjig->_init_near = _near;
         }
+        __normal_call void_type push_init_keep (
+            bool          _keep
+            )
+        {
+            this->
+           _jjig->_init_keep = _keep;
+        }
+        __normal_call void_type push_init_halo (
+            std::int32_t  _halo
+            )
+        {
+            this->
+           _jjig->_init_halo = _halo;
+        }
 
     /*------------------------------------- HFUN keywords */
         __normal_call void_type push_hfun_scal (
@@ -143,6 +157,20 @@
             this->
            _jjig->_hfun_hmin = _hmin;
         }
+        __normal_call void_type push_hfun_clip (
+            std::int32_t  _clip
+            )
+        {
+            this->
+           _jjig->_hfun_clip = _clip;
+        }
+        __normal_call void_type push_hfun_cpus (
+            std::int32_t  _cpus
+            )
+        {
+            this->
+           _jjig->_hfun_cpus = _cpus;
+        }
 
     /*------------------------------------- BNDS keywords */
         __normal_call void_type push_bnds_kern (
@@ -169,6 +197,13 @@
             this->
            _jjig->_mesh_dims = _dims;
         }
+        __normal_call void_type push_mesh_cpus (
+            std::int32_t  _cpus
+            )
+        {
+            this->
+           _jjig->_mesh_cpus = _cpus;
+        }
         __normal_call void_type push_mesh_iter (
             std::int32_t  _iter
             )
@@ -333,6 +368,13 @@
             this->
            _jjig->_optm_zip_ = _flag;
         }
+        __normal_call void_type push_optm_cpus (
+            std::int32_t  _cpus
+            )
+        {
+            this->
+           _jjig->_optm_cpus = _cpus;
+        }
 
         } ;
 
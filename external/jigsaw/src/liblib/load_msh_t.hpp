@@ -622,7 +622,6 @@
         try
         {
             jmsh_reader   _read ;
-            std::ifstream _file ;
 
             std::string _fstr(_fchr) ;
             std::string _path ;
@@ -631,21 +630,12 @@
             file_part(_fstr,
                 _path, _name, _fext) ;
 
-            _file.open(
-                _fstr, std::ifstream:: in) ;
-
-            if (_file.is_open() )
-            {
-                _read.read_file (
-                _file, msht_reader(_jmsh)) ;
-            }
-            else
+            if (!_read.read_file (
+                _fstr, msht_reader(_jmsh)))
             {
                 _errv = __file_not_located ;
             }
 
-            _file.close ();
-
             if(!_read._errs.empty())
             {
                 _errv = __invalid_argument ;
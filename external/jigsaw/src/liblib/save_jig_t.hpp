@@ -100,6 +100,11 @@
                 _file << "INIT_NEAR = " <<
                     _jcfg->_init_near << "\n" ;
 
+                _file << "INIT_KEEP = " <<
+                    _jcfg->_init_keep << "\n" ;
+                _file << "INIT_HALO = " <<
+                    _jcfg->_init_halo << "\n" ;
+
         /*--------------------------------- HFUN keywords */
                 if (_jcfg->_hfun_scal ==
                         JIGSAW_HFUN_RELATIVE)
@@ -116,6 +121,19 @@
                 _file << "HFUN_HMAX = " <<
                     _jcfg->_hfun_hmin << "\n" ;
 
+                if (_jcfg->_hfun_clip ==
+                        JIGSAW_HFUN_MARCHING)
+                _file << "HFUN_CLIP = "
+                      << "MARCHING\n" ;
+                else
+                if (_jcfg->_hfun_clip ==
+                        JIGSAW_HFUN_SWEEPING)
+                _file << "HFUN_CLIP = "
+                      << "SWEEPING\n" ;
+
+                _file << "HFUN_CPUS = " <<
+                    _jcfg->_hfun_cpus << "\n" ;
+
         /*--------------------------------- BNDS keywords */
                 if (_jcfg->_bnds_kern ==
                         JIGSAW_BNDS_TRIACELL)
@@ -142,6 +160,9 @@
                 _file << "MESH_DIMS = " <<
                     _jcfg->_mesh_dims << "\n" ;
 
+                _file << "MESH_CPUS = " <<
+                    _jcfg->_mesh_cpus << "\n" ;
+
                 _file << "MESH_ITER = " <<
                     _jcfg->_mesh_iter << "\n" ;
 
@@ -213,6 +234,9 @@
                     _jcfg->_optm_div_ << "\n" ;
                 _file << "OPTM_ZIP_ = " <<
                     _jcfg->_optm_zip_ << "\n" ;
+
+                _file << "OPTM_CPUS = " <<
+                    _jcfg->_optm_cpus << "\n" ;
             }
             else
             {
@@ -112,6 +112,9 @@
     /*--------------------------------- init. geo. kernel */
         mp_float::exactinit() ;
 
+    /*--------------------------------- init. perf. stats */
+        reset_stat() ;
+
     /*--------------------------------- setup *.JLOG data */
         if (_jjig != nullptr )
         {
@@ -156,6 +159,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-cfg-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -187,6 +192,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-ffun-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -221,6 +228,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-ffun-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -231,6 +240,15 @@
             _jlog.push (
                 "  Fast-march solver...\n\n" ) ;
 
+            if (_jcfg._hfun_clip ==
+                jcfg_data::hfun_clip::sweeping &&
+                _ffun._kind ==
+                jmsh_kind::euclidean_grid &&
+                _ffun._ndim == +3)
+            _jlog.push (
+    "  **HFUN-CLIP = SWEEPING ignored: no |dh/dx| limits\n"
+    "  for 3-dim. EUCLIDEAN-GRID data...\n\n" ) ;
+
 #           ifdef  __use_timers
             _ttic   = _time.now();
 #           endif//__use_timers
@@ -240,6 +258,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("fast-march-solver",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -264,6 +284,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("writing-ffun-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -299,6 +321,9 @@
     /*--------------------------------- init. geo. kernel */
         mp_float::exactinit() ;
 
+    /*--------------------------------- init. perf. stats */
+        reset_stat() ;
+
     /*-------------------------- find *.JFCG file in args */
         iptr_type _retv = -1  ;
         jcfg_data _jcfg ;
@@ -390,9 +415,14 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-cfg-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
+    /*--------------------------------- init. perf. stats */
+        open_stat(_jcfg) ;
+
         if(!_jcfg._hfun_file.empty())
         {
     /*--------------------------------- parse *.HFUN file */
@@ -421,6 +451,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-ffun-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -455,6 +487,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-ffun-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -465,6 +499,15 @@
             _jlog.push (
                 "  Fast-march solver...\n\n" ) ;
 
+            if (_jcfg._hfun_clip ==
+                jcfg_data::hfun_clip::sweeping &&
+                _ffun._kind ==
+                jmsh_kind::euclidean_grid &&
+                _ffun._ndim == +3)
+            _jlog.push (
+    "  **HFUN-CLIP = SWEEPING ignored: no |dh/dx| limits\n"
+    "  for 3-dim. EUCLIDEAN-GRID data...\n\n" ) ;
+
 #           ifdef  __use_timers
             _ttic   = _time.now();
 #           endif//__use_timers
@@ -474,6 +517,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("fast-march-solver",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -498,9 +543,22 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("writing-ffun-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
+        if(!_jcfg._stat_file.empty())
+        {
+    /*--------------------------------- dump stat to file */
+            if ((_retv = save_stat (
+                 _jcfg,
+                 _jlog, "marche")) != __no_error)
+            {
+                return  _retv ;
+            }
+        }
+
     /*-------------------------- success, if we got here! */
 
         return ( _retv ) ;
@@ -0,0 +1,1654 @@
+    /*
+    --------------------------------------------------------
+     * MSH-INCR: local re-meshing of a previous mesh.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 18 October, 2026
+     *
+     * Copyright 2013-2020
+     * Darren Engwirda
+     * d.engwirda@gmail.com
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+
+#   pragma once
+
+#   ifndef __MSH_INCR__
+#   define __MSH_INCR__
+
+    /*
+    --------------------------------------------------------
+     * INCR-DATA: work-space for local re-meshing.
+    --------------------------------------------------------
+     */
+
+    // The previous mesh (INIT) is split into a "cavity" of
+    // TRIA3 cells to re-mesh, and the "frozen" remainder.
+    // Cavity nodes adj. to frozen cells, or on EDGE2 cells,
+    // are kept: they form the sub-problem GEOM + INIT.
+    // Outer edges of the cavity are chords of the GEOM,
+    // and are re-formed from the GEOM nodes between them.
+    // Disjoint cavities are split into "parts", each its
+    // own sub-problem. TMRK is +1 for cells of the part in
+    // hand, +2 for parts still to do, and +0 otherwise.
+
+    class incr_data
+        {
+        public  :
+        typedef containers::array <
+                iptr_type >         iptr_list ;
+        typedef containers::array <
+                char_type >         flag_list ;
+
+        class gvtx_data
+            {
+            public  :
+            iptr_type           _edge ;
+            iptr_type           _node ;
+            } ;
+
+        class gvtx_less
+            {
+            public  :
+    /*------------------------ sort GEOM nodes by EDGE2 */
+            __inline_call
+                bool_type operator () (
+                gvtx_data const&_idat ,
+                gvtx_data const&_jdat
+                ) const
+            {
+                return _idat._edge <
+                       _jdat._edge ;
+            }
+            } ;
+
+    /*------------------------- cavity cells + last ring */
+        iptr_list               _tcav ;
+        iptr_list               _tnew ;
+        flag_list               _tmrk ;
+
+    /*------------------------- cavity parts, CSR-style */
+        iptr_list               _cptr ;
+        iptr_list               _ccel ;
+
+    /*------------------------- INIT-to-sub. node maps */
+        flag_list               _nmrk ;
+        iptr_list               _nmap ;
+        iptr_list               _nold ;
+        iptr_list               _ndel ;
+        iptr_list               _nset ;
+
+    /*------------------------- INIT EDGE2 to re-mesh */
+        iptr_list               _eold ;
+
+    /*------------------------- sub. edges: (i, j, tag) */
+        iptr_list               _eint ;
+        iptr_list               _eout ;
+
+    /*------------------------- outer edges: (EDGE2, opp.) */
+        iptr_list               _ebnd ;
+
+    /*------------------------- GEOM nodes by INIT EDGE2 */
+        containers::array <
+            gvtx_data >         _gvtx ;
+
+    /*------------------------- sub-to-mesh node maps */
+        iptr_list               _smap ;
+        iptr_list               _nsub ;
+
+        iptr_type               _itag = +0 ;
+        iptr_type               _ttag = +0 ;
+
+        real_type               _area = +0.;
+        real_type               _aerr = +0.;
+
+        iptr_type               _nbad = +0 ;
+
+    /*------------------------- why the last check failed */
+        char const             *_fail = "" ;
+        } ;
+
+    /*
+    --------------------------------------------------------
+     * INCR-PROJ: project point to GEOM, return edge idx.
+    --------------------------------------------------------
+     */
+
+    __normal_call iptr_type incr_proj (
+        geom_data::euclidean_mesh_2d &_geom ,
+        real_type *_ppos ,
+        real_type *_proj
+        )
+    {
+        typedef geom_data::
+            euclidean_mesh_2d      geom_type ;
+
+        float      _PPOS[2] = {
+       (float)     _ppos[0] ,
+       (float)     _ppos[1] } ;
+
+        _proj[0] = _ppos[0] ;
+        _proj[1] = _ppos[1] ;
+
+        typename geom_type::near_edge_pred _func (
+            _ppos, _proj, &_geom._tria) ;
+
+        _geom._ebox.near(_PPOS, _func) ;
+
+        return _func._epos ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-NEAR: TRUE if point is "on" the geometry.
+    --------------------------------------------------------
+     */
+
+    __normal_call bool_type incr_near (
+        geom_data::euclidean_mesh_2d &_geom ,
+        real_type *_ppos ,
+        real_type  _DTOL
+        )
+    {
+        real_type _proj[2] ;
+        if (incr_proj(_geom, _ppos, _proj) < +0)
+            return false ;
+
+        return geometry::lensqr_2d(
+            _ppos, _proj) <= _DTOL ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-GEOM: TRUE if GEOM differs from INIT bnd.'s.
+    --------------------------------------------------------
+     */
+
+    // Each EDGE2 cell in INIT must lie on the GEOM, and
+    // each GEOM edge must lie on the EDGE2 cells in INIT.
+    // EDGE2 cells are chords of the GEOM: end-points are
+    // "on" the GEOM, but mid-points (and GEOM nodes) may
+    // be off by up to the local EDGE2 length.
+    // GEOM nodes are also indexed by their nearest EDGE2
+    // cell, to re-mesh cavity bnd.'s against the GEOM.
+
+    __normal_call bool_type incr_geom (
+        jcfg_data &_jcfg ,
+        geom_data &_geom ,
+        mesh_data &_mesh ,
+        incr_data &_incr
+        )
+    {
+        typedef geom_data::
+            euclidean_mesh_2d      geom_type ;
+
+        typedef typename
+            incr_data::gvtx_data   gvtx_data ;
+
+        auto &_gnew = _geom._euclidean_mesh_2d ;
+        auto &_tria =
+            _mesh._euclidean_mesh_2d._mesh;
+
+        real_type static const _ETOL =
+            std::pow(std::numeric_limits
+                <real_type>::epsilon(), +.75) ;
+
+        real_type static constexpr _FRAC =
+            (real_type) 1./ 1. ;
+
+        real_type _NTOL = std::max(
+            _gnew._bmax[0] - _gnew._bmin[0] ,
+            _gnew._bmax[1] - _gnew._bmin[1]) ;
+
+        _NTOL *= std::max (
+            _jcfg._mesh_opts.near(), _ETOL) ;
+        _NTOL *= _NTOL ;
+
+        _incr._gvtx.set_count(+0) ;
+
+    /*-------------------- INIT EDGE2 cells on to GEOM */
+        geom_type _gold ;
+
+        typename incr_data::iptr_list _nmap (
+            _tria.node().count(), -1) ;
+        typename incr_data::iptr_list _emap ;
+
+        for (auto _epos = +0 ; _epos <
+            (iptr_type)_tria.edge().count() ;
+                ++_epos )
+        {
+            auto &_edat = _tria.edge(_epos) ;
+
+            if (_edat.mark() < +0) continue ;
+            if (_edat.self() < +1) continue ;
+
+            real_type *_ipos =
+               &_tria.node(_edat.node(0)).pval(0) ;
+            real_type *_jpos =
+               &_tria.node(_edat.node(1)).pval(0) ;
+
+            real_type _pmid[2] = {
+           (real_type)+.5 * (_ipos[0] + _jpos[0]) ,
+           (real_type)+.5 * (_ipos[1] + _jpos[1])
+                } ;
+
+            real_type _LTOL = std::max(_NTOL,
+                _FRAC * _FRAC *
+            geometry::lensqr_2d(_ipos, _jpos)) ;
+
+            if (!incr_near(_gnew, _ipos, _NTOL) ||
+                !incr_near(_gnew, _jpos, _NTOL) ||
+                !incr_near(_gnew, _pmid, _LTOL) )
+                return true ;
+
+            typename geom_type::edge_type _gdat ;
+            for (auto _inum = +2; _inum-- != +0; )
+            {
+                auto _npos = _edat.node(_inum) ;
+
+                if (_nmap[_npos] == -1)
+                {
+                typename
+                    geom_type::node_type _ndat ;
+                _ndat.pval(0) =
+                _tria.node(_npos).pval(0) ;
+                _ndat.pval(1) =
+                _tria.node(_npos).pval(1) ;
+                _ndat.itag () = +0 ;
+
+                _nmap[_npos] = _gold.
+                _tria.push_node(_ndat, false) ;
+                }
+
+                _gdat.node(_inum) = _nmap[_npos] ;
+            }
+
+            _gdat.itag () = _edat.itag () ;
+
+            _gold._tria.push_edge(_gdat, false) ;
+
+            _emap.push_tail(_epos) ;
+        }
+
+        if (_gold._tria.edge().empty())
+        {
+    /*-------------------- no EDGE2 cells: no bnd. data */
+            return !_gnew._tria.edge().empty() ;
+        }
+
+        jcfg_data::mesh_opts _opts =
+            _jcfg._mesh_opts ;
+
+        _opts.feat() = false ;
+
+        _gold._tria.make_link() ;
+        _gold.init_geom(_opts) ;
+
+    /*-------------------- GEOM edges on to INIT EDGE2 */
+        typename incr_data::flag_list _done (
+            _gnew._tria.node().count(), +0) ;
+
+        for (auto _iter  = _gnew._tria.edge().head() ;
+                  _iter != _gnew._tria.edge().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() < +0) continue ;
+
+            real_type *_ipos = &_gnew.
+                _tria.node(_iter->node(0)).pval(0) ;
+            real_type *_jpos = &_gnew.
+                _tria.node(_iter->node(1)).pval(0) ;
+
+            real_type _pmid[2] = {
+           (real_type)+.5 * (_ipos[0] + _jpos[0]) ,
+           (real_type)+.5 * (_ipos[1] + _jpos[1])
+                } ;
+
+            real_type *_ppos[3] = {
+                _ipos, _jpos, _pmid } ;
+
+            for (auto _inum = +0; _inum < +3; ++_inum)
+            {
+                real_type _proj[2] ;
+                iptr_type _epos = incr_proj(
+                    _gold, _ppos[_inum], _proj) ;
+
+                if (_epos < +0) return true ;
+
+                auto &_gdat =
+                    _gold._tria.edge(_epos) ;
+
+                real_type _LTOL = std::max(_NTOL,
+                    _FRAC * _FRAC *
+                geometry::lensqr_2d (
+               &_gold._tria.node(
+                    _gdat.node(0)).pval(0) ,
+               &_gold._tria.node(
+                    _gdat.node(1)).pval(0))) ;
+
+                if (geometry::lensqr_2d(
+                    _ppos[_inum], _proj) > _LTOL)
+                    return true ;
+
+                if (_inum == +2) continue ;
+
+                auto _npos = _iter->node(_inum) ;
+
+                if (_done[_npos] != +0) continue ;
+
+                _done[_npos] = +1 ;
+
+                gvtx_data _vdat ;
+                _vdat._edge = _emap[_epos] ;
+                _vdat._node = _npos ;
+
+                _incr._gvtx.push_tail(_vdat) ;
+            }
+        }
+
+        algorithms::qsort(_incr._gvtx.head() ,
+                          _incr._gvtx.tend() ,
+            typename incr_data::gvtx_less()) ;
+
+        return false ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-MARK: find INIT cells that violate H(x).
+    --------------------------------------------------------
+     */
+
+    // A TRIA3 is "stale" if an edge is longer than the
+    // 11/8 * h split threshold used by ITER-MESH, or is
+    // shorter than 2/5 * h. H(x) is evaluated once per
+    // node, as a single batch.
+
+    template <
+        typename  hfun_type
+             >
+    __normal_call void_type incr_mark (
+        hfun_type &_hfun ,
+        mesh_data &_mesh ,
+        incr_data &_incr
+        )
+    {
+        typedef typename
+            hfun_type::hint_type   hint_type ;
+
+        real_type static constexpr _LONG =
+            (real_type) 11./ 8. ;
+        real_type static constexpr _TINY =
+            (real_type)  2./ 5. ;
+
+        auto &_tria =
+            _mesh._euclidean_mesh_2d._mesh;
+
+        iptr_type _nnum =
+            (iptr_type)_tria.node().count() ;
+        iptr_type _tnum =
+            (iptr_type)_tria.tri3().count() ;
+
+        _incr._tmrk.set_count(_tnum,
+            containers::tight_alloc, +0) ;
+        _incr._nmrk.set_count(_nnum,
+            containers::tight_alloc, +0) ;
+        _incr._nmap.set_count(_nnum,
+            containers::tight_alloc, -1) ;
+
+        _incr._tcav.set_count(+0) ;
+        _incr._tnew.set_count(+0) ;
+        _incr._nbad = +0 ;
+
+        if (_nnum == +0) return ;
+
+    /*-------------------- eval. H(x) at all INIT nodes */
+        containers::array<real_type> _ppos (
+            _nnum * 2, (real_type)+0.) ;
+        containers::array<real_type> _hval (
+            _nnum * 1, (real_type)+0.) ;
+        containers::array<hint_type> _hint (
+            _nnum * 1,
+                hfun_type::null_hint()) ;
+
+        for (auto _npos = +0; _npos < _nnum; ++_npos)
+        {
+            _ppos[_npos * 2 + 0] =
+                _tria.node(_npos).pval(0) ;
+            _ppos[_npos * 2 + 1] =
+                _tria.node(_npos).pval(1) ;
+        }
+
+        _hfun.eval(_nnum, &_ppos[0] ,
+                  &_hint[0], &_hval[0]) ;
+
+    /*-------------------- mark cells with "bad" edges */
+        for (auto _tpos = +0; _tpos < _tnum; ++_tpos)
+        {
+            auto &_tdat = _tria.tri3(_tpos) ;
+
+            if (_tdat.mark() < +0) continue ;
+
+            for (auto _epos = +3; _epos-- != +0; )
+            {
+                iptr_type _enod[3] ;
+                mesh_data::euclidean_mesh_2d::
+                mesh_type::tri3_type::
+                face_node(_enod, _epos, 2, 1) ;
+
+                auto _inod = _tdat.node(_enod[0]) ;
+                auto _jnod = _tdat.node(_enod[1]) ;
+
+                real_type _lsqr =
+                    geometry::lensqr_2d (
+               &_tria.node(_inod).pval(0) ,
+               &_tria.node(_jnod).pval(0)) ;
+
+                real_type _hmax = std::max(
+                    _hval[_inod], _hval[_jnod]) ;
+                real_type _hmin = std::min(
+                    _hval[_inod], _hval[_jnod]) ;
+
+                _hmax *= _LONG ;
+                _hmin *= _TINY ;
+
+                if (_lsqr > _hmax * _hmax ||
+                    _lsqr < _hmin * _hmin )
+                {
+                    _incr._tmrk[_tpos] = +1 ;
+                    _incr._tcav.push_tail(_tpos) ;
+                    _incr._tnew.push_tail(_tpos) ;
+                    _incr._nbad += +1 ;
+                    break ;
+                }
+            }
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-HALO: grow cavity by RING layers of adj. cells.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type incr_halo (
+        mesh_data &_mesh ,
+        incr_data &_incr ,
+        iptr_type  _ring
+        )
+    {
+        typedef mesh_data::euclidean_mesh_2d::
+                mesh_type          mesh_type ;
+
+        auto &_tria =
+            _mesh._euclidean_mesh_2d._mesh;
+
+        typename mesh_type::connector _conn ;
+        typename incr_data::iptr_list _next ;
+
+        for (auto _iter = +0; _iter < _ring; ++_iter)
+        {
+            _next.set_count(+0) ;
+
+            for (auto _tpos  = _incr._tnew.head() ;
+                      _tpos != _incr._tnew.tend() ;
+                    ++_tpos  )
+            {
+            for (auto _inum = +3; _inum-- != +0; )
+            {
+                _conn.set_count(+0) ;
+                _tria.connect_2(
+                    _tria.tri3(*_tpos).node(_inum),
+                        mesh::POINT_tag, _conn) ;
+
+                for (auto _cell  = _conn.head() ;
+                          _cell != _conn.tend() ;
+                        ++_cell  )
+                {
+                    if (_cell->_kind != mesh::TRIA3_tag)
+                        continue ;
+
+                    if (_incr.
+                        _tmrk[_cell->_cell] != +0)
+                        continue ;
+
+                    _incr._tmrk[_cell->_cell] = +1 ;
+                    _incr._tcav.push_tail(
+                        _cell->_cell) ;
+                    _next.push_tail(_cell->_cell) ;
+                }
+            }
+            }
+
+            std::swap(_incr._tnew, _next) ;
+
+            if (_incr._tnew.empty()) break ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-PART: split cavity into node-disjoint parts.
+    --------------------------------------------------------
+     */
+
+    // Cells of the cavity are walked "breadth-first" over
+    // shared nodes. Each part is held as a CCEL range in
+    // CPTR, and its cells are left with TMRK = +2.
+
+    __normal_call void_type incr_part (
+        mesh_data &_mesh ,
+        incr_data &_incr
+        )
+    {
+        typedef mesh_data::euclidean_mesh_2d::
+                mesh_type          mesh_type ;
+
+        auto &_tria =
+            _mesh._euclidean_mesh_2d._mesh;
+
+        typename mesh_type::connector _conn ;
+
+        _incr._cptr.set_count(+0) ;
+        _incr._ccel.set_count(+0) ;
+
+        _incr._cptr.push_tail(+0) ;
+
+        for (auto _iter  = _incr._tcav.head() ;
+                  _iter != _incr._tcav.tend() ;
+                ++_iter  )
+        {
+            if (_incr._tmrk[*_iter] != +1) continue ;
+
+    /*-------------------- seed new part, walk out to bnd. */
+            _incr._tmrk[*_iter] = +2 ;
+            _incr._ccel.push_tail(*_iter) ;
+
+            for (auto _ipos = *_incr._cptr.tail() ;
+                      _ipos < (iptr_type)
+                      _incr._ccel.count(); ++_ipos)
+            {
+            auto _tpos = _incr._ccel[_ipos] ;
+
+            for (auto _inum = +3; _inum-- != +0; )
+            {
+                _conn.set_count(+0) ;
+                _tria.connect_2(
+                    _tria.tri3(_tpos).node(_inum),
+                        mesh::POINT_tag, _conn) ;
+
+                for (auto _cell  = _conn.head() ;
+                          _cell != _conn.tend() ;
+                        ++_cell  )
+                {
+                    if (_cell->_kind != mesh::TRIA3_tag)
+                        continue ;
+
+                    if (_incr.
+                        _tmrk[_cell->_cell] != +1)
+                        continue ;
+
+                    _incr._tmrk[_cell->_cell] = +2 ;
+                    _incr._ccel.push_tail(
+                        _cell->_cell) ;
+                }
+            }
+            }
+
+            _incr._cptr.push_tail(
+           (iptr_type)_incr._ccel.count()) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-NEXT: close last cavity, open part IPOS.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type incr_next (
+        incr_data &_incr ,
+        iptr_type  _ipos
+        )
+    {
+        for (auto _iter  = _incr._tcav.head() ;
+                  _iter != _incr._tcav.tend() ;
+                ++_iter  )
+        {
+            _incr._tmrk[*_iter] = +0 ;
+        }
+
+        _incr._tcav.set_count(+0) ;
+        _incr._tnew.set_count(+0) ;
+
+        for (auto _cpos = _incr._cptr[_ipos + 0] ;
+                  _cpos < _incr._cptr[_ipos + 1] ;
+                ++_cpos  )
+        {
+            auto _tpos = _incr._ccel[_cpos] ;
+
+            _incr._tmrk[_tpos] = +1 ;
+            _incr._tcav.push_tail(_tpos) ;
+            _incr._tnew.push_tail(_tpos) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-GVTX: GEOM nodes on INIT EDGE2, in order.
+    --------------------------------------------------------
+     */
+
+    // Push the GEOM nodes indexed to EDGE2 cell EIDX that
+    // fall strictly between its end-points A, B, sorted
+    // by their param. along A-B. Nodes "inside" of A-B
+    // must fall within its cavity cell A-B-C, else none
+    // are pushed, and the chord A-B is kept as-is.
+
+    __normal_call void_type incr_gvtx (
+        geom_data &_geom ,
+        incr_data &_incr ,
+        iptr_type  _eidx ,
+        real_type *_apos ,
+        real_type *_bpos ,
+        real_type *_cpos ,
+        containers::array <
+        typename incr_data::gvtx_data> &_gsrt
+        )
+    {
+        typedef typename
+            incr_data::gvtx_data   gvtx_data ;
+
+        class tval_sort
+            {
+            public  :
+            real_type           _tval ;
+            iptr_type           _node ;
+            } ;
+
+        class tval_less
+            {
+            public  :
+    /*------------------------ sort nodes by param. A-B */
+            __inline_call
+                bool_type operator () (
+                tval_sort const&_idat ,
+                tval_sort const&_jdat
+                ) const
+            {
+                return _idat._tval <
+                       _jdat._tval ;
+            }
+            } ;
+
+        real_type static const _TTOL =
+            std::sqrt(std::numeric_limits
+                <real_type>::epsilon()) ;
+
+        auto &_gnew = _geom._euclidean_mesh_2d ;
+
+        _gsrt.set_count(+0) ;
+
+        if (_eidx < +0 ||
+            _incr._gvtx.empty()) return ;
+
+        real_type _vlen[2] = {
+            _bpos[0] - _apos[0] ,
+            _bpos[1] - _apos[1] } ;
+
+        real_type _lsqr =
+            geometry::lensqr_2d(_apos, _bpos) ;
+
+        if (_lsqr <= (real_type)+0.) return ;
+
+        gvtx_data _vdat ;
+        _vdat._edge = _eidx ;
+        _vdat._node = -1 ;
+
+        gvtx_data *_head = &_incr._gvtx[0] ;
+        gvtx_data *_tend =
+            _head + _incr._gvtx.count() ;
+
+        containers::array<tval_sort> _tsrt ;
+
+        for (auto _iter = std::lower_bound(
+                _head, _tend, _vdat,
+            typename incr_data::gvtx_less()) ;
+                  _iter != _tend &&
+                  _iter->_edge == _eidx ;
+                ++_iter  )
+        {
+            real_type *_gpos = &_gnew.
+                _tria.node(_iter->_node).pval(0) ;
+
+            tval_sort _tdat ;
+            _tdat._node = _iter->_node ;
+            _tdat._tval = (
+               (_gpos[0] - _apos[0]) * _vlen[0] +
+               (_gpos[1] - _apos[1]) * _vlen[1]
+                ) / _lsqr ;
+
+            if (_tdat._tval <= +0. + _TTOL ||
+                _tdat._tval >= +1. - _TTOL)
+                continue ;
+
+            real_type _sabc = geometry::
+                tria_area_2d(_apos, _bpos, _cpos) ;
+            real_type _sabg = geometry::
+                tria_area_2d(_apos, _bpos, _gpos) ;
+
+            if (_sabg * _sabc > (real_type)+0.)
+            {
+    /*-------------------- "inside" of A-B: must be in C */
+                if (geometry::tria_area_2d(
+                    _bpos, _cpos, _gpos) * _sabc
+                        <= (real_type)+0. ||
+                    geometry::tria_area_2d(
+                    _cpos, _apos, _gpos) * _sabc
+                        <= (real_type)+0. )
+                    return ;
+            }
+
+            _tsrt.push_tail(_tdat) ;
+        }
+
+        algorithms::qsort(_tsrt.head() ,
+                          _tsrt.tend() ,
+            tval_less() ) ;
+
+        for (auto _iter  = _tsrt.head() ;
+                  _iter != _tsrt.tend() ;
+                ++_iter  )
+        {
+            _vdat._node = _iter->_node ;
+
+            _gsrt.push_tail(_vdat) ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-CAVS: form sub-problem GEOM + INIT for cavity.
+    --------------------------------------------------------
+     */
+
+    // Edges of the cavity are: "interface" edges, shared
+    // with frozen cells, which are kept as un-refinable
+    // INIT constraints; and "outer" edges, on the bnd. of
+    // the mesh, that can be refined against the GEOM.
+    // Cells adj. to EDGE2 cells interior to the mesh are
+    // left frozen. Returns FALSE if the cavity is not
+    // supported: growing it further will not help.
+
+    __normal_call bool_type incr_cavs (
+        jcfg_data &_jcfg ,
+        geom_data &_geom ,
+        mesh_data &_mesh ,
+        incr_data &_incr ,
+        geom_data &_sgeo ,
+        mesh_data &_sini
+        )
+    {
+        typedef mesh_data::euclidean_mesh_2d::
+                mesh_type          mesh_type ;
+
+        auto &_tria =
+            _mesh._euclidean_mesh_2d._mesh;
+
+        typename mesh_type::connector _conn ;
+
+    /*-------------------- reset maps from last attempt */
+        for (auto _iter  = _incr._nset.head() ;
+                  _iter != _incr._nset.tend() ;
+                ++_iter  )
+        {
+            _incr._nmrk[*_iter] = +0 ;
+            _incr._nmap[*_iter] = -1 ;
+        }
+
+        _incr._nset.set_count(+0) ;
+        _incr._nold.set_count(+0) ;
+        _incr._ndel.set_count(+0) ;
+        _incr._eold.set_count(+0) ;
+        _incr._eint.set_count(+0) ;
+        _incr._eout.set_count(+0) ;
+        _incr._ebnd.set_count(+0) ;
+
+        _incr._itag = +1 ;
+        _incr._area = (real_type)+0. ;
+        _incr._aerr = (real_type)+0. ;
+
+    /*-------------------- freeze cells adj. to int. EDGE2 */
+        iptr_type _tnum = +0 ;
+
+        for (auto _ipos = +0 ; _ipos <
+            (iptr_type)_incr._tcav.count() ;
+                ++_ipos )
+        {
+            auto  _tpos = _incr._tcav[_ipos] ;
+            auto &_tdat = _tria.tri3(_tpos) ;
+
+            bool_type _keep = true ;
+
+            for (auto _epos = +3; _epos-- != +0; )
+            {
+                iptr_type _enod[3], _eidx = -1 ;
+                mesh_type::tri3_type::
+                face_node(_enod, _epos, 2, 1) ;
+
+                _enod[0] = _tdat.node(_enod[0]) ;
+                _enod[1] = _tdat.node(_enod[1]) ;
+
+                if (!_tria.find_edge(_enod, _eidx))
+                    continue ;
+
+                if (_tria.edge(_eidx).self() < +1)
+                    continue ;
+
+                _conn.set_count(+0) ;
+                _tria.connect_2(
+                    _eidx, mesh::EDGE2_tag, _conn) ;
+
+                if (_conn.count() >= +2)
+                    _keep = false ;
+            }
+
+            if (_keep)
+                _incr._tcav[_tnum++] = _tpos ;
+            else
+                _incr._tmrk[_tpos] = +0 ;
+        }
+
+        _incr._tcav.set_count(_tnum) ;
+
+        if (_incr._tcav.empty())
+        {
+            _incr._fail = "all cells adj. to EDGE2" ;
+            return false ;
+        }
+
+        _incr._ttag =
+        _tria.tri3(_incr._tcav[0]).itag() ;
+
+        for (auto _tpos  = _incr._tcav.head() ;
+                  _tpos != _incr._tcav.tend() ;
+                ++_tpos  )
+        {
+            if (_tria.tri3(*_tpos).itag() != _incr._ttag)
+            {
+    /*-------------------- cavity spans multiple PARTs */
+                _incr._fail = "spans multiple PARTs" ;
+                return false ;
+            }
+        }
+
+    /*-------------------- keep nodes adj. to the frozen */
+        for (auto _tpos  = _incr._tcav.head() ;
+                  _tpos != _incr._tcav.tend() ;
+                ++_tpos  )
+        {
+            auto &_tdat = _tria.tri3(*_tpos) ;
+
+            _incr._area += std::abs(
+                geometry::tria_area_2d (
+           &_tria.node(_tdat.node(0)).pval(0) ,
+           &_tria.node(_tdat.node(1)).pval(0) ,
+           &_tria.node(_tdat.node(2)).pval(0))) ;
+
+            for (auto _inum = +3; _inum-- != +0; )
+            {
+                auto  _npos = _tdat.node(_inum) ;
+
+                if (_incr._nmrk[_npos] != +0)
+                    continue ;
+
+                bool_type _keep =
+                _tria.node(_npos).feat() !=
+                    mesh::null_feat ;
+
+                _conn.set_count(+0) ;
+                _tria.connect_2(
+                    _npos, mesh::POINT_tag, _conn) ;
+
+                for (auto _cell  = _conn.head() ;
+                          _cell != _conn.tend() ;
+                        ++_cell  )
+                {
+                    if (_cell->_kind != mesh::TRIA3_tag ||
+                        _incr.
+                        _tmrk[_cell->_cell] != +1)
+                        _keep = true ;
+                }
+
+                _conn.set_count(+0) ;
+                _tria.connect_1(
+                    _npos, mesh::POINT_tag, _conn) ;
+
+                for (auto _cell  = _conn.head() ;
+                          _cell != _conn.tend() ;
+                        ++_cell  )
+                {
+                    if (_cell->_kind == mesh::EDGE2_tag &&
+                        _tria.edge(
+                        _cell->_cell).self() >= +1)
+                        _keep = true ;
+                }
+
+                _incr._nmrk[_npos] = _keep ? +1 : +2 ;
+                _incr._nset.push_tail(_npos) ;
+            }
+        }
+
+    /*-------------------- sort edges of cavity by kind */
+        for (auto _tpos  = _incr._tcav.head() ;
+                  _tpos != _incr._tcav.tend() ;
+                ++_tpos  )
+        {
+            auto &_tdat = _tria.tri3(*_tpos) ;
+
+            for (auto _epos = +3; _epos-- != +0; )
+            {
+                iptr_type _enod[3], _eidx = -1 ;
+                mesh_type::tri3_type::
+                face_node(_enod, _epos, 2, 1) ;
+
+                _enod[0] = _tdat.node(_enod[0]) ;
+                _enod[1] = _tdat.node(_enod[1]) ;
+                _enod[2] = _tdat.node(_enod[2]) ;
+
+                if (!_tria.find_edge(_enod, _eidx))
+                {
+                    _incr._fail = "cavity edge not found" ;
+                    return false ;
+                }
+
+                iptr_type _ncav = +0, _nout = +0 ;
+
+                _conn.set_count(+0) ;
+                _tria.connect_2(
+                    _eidx, mesh::EDGE2_tag, _conn) ;
+
+                for (auto _cell  = _conn.head() ;
+                          _cell != _conn.tend() ;
+                        ++_cell  )
+                {
+                    if (_cell->_kind == mesh::TRIA3_tag &&
+                        _incr.
+                        _tmrk[_cell->_cell] == +1)
+                    {
+                        _ncav += +1 ;
+                    }
+                    else
+                        _nout += +1 ;
+                }
+
+                auto &_edat = _tria.edge(_eidx) ;
+
+                bool_type _cell =
+                    _edat.self() >= +1 ;
+
+                if (_cell)
+                _incr._itag = std::max(
+                _incr._itag, _edat.itag() + 1) ;
+
+                if (_ncav >= +2) continue ;
+
+                if (_nout >= +1)
+                {
+    /*-------------------- interface with frozen cells */
+                    _incr._eint.push_tail(_enod[0]) ;
+                    _incr._eint.push_tail(_enod[1]) ;
+                    _incr._eint.push_tail(-1) ;
+                }
+                else
+                {
+    /*-------------------- outer bnd. of the mesh */
+                    if (_cell)
+                    _incr._eold.push_tail(_eidx) ;
+
+                    _incr._eout.push_tail(_enod[0]) ;
+                    _incr._eout.push_tail(_enod[1]) ;
+                    _incr._eout.push_tail(
+                        _cell ? _edat.itag() : +0) ;
+
+                    _incr._ebnd.push_tail(
+                        _cell ? _eidx : -1) ;
+                    _incr._ebnd.push_tail(_enod[2]) ;
+                }
+
+                _incr._nmrk[_enod[0]] = +1 ;
+                _incr._nmrk[_enod[1]] = +1 ;
+            }
+        }
+
+    /*-------------------- index kept nodes in sub-prob. */
+        for (auto _tpos  = _incr._tcav.head() ;
+                  _tpos != _incr._tcav.tend() ;
+                ++_tpos  )
+        {
+            auto &_tdat = _tria.tri3(*_tpos) ;
+
+            for (auto _inum = +0; _inum < +3; ++_inum)
+            {
+                auto  _npos = _tdat.node(_inum) ;
+
+                if (_incr._nmrk[_npos] == +1)
+                {
+                    _incr._nmap[_npos] =
+                   (iptr_type)_incr._nold.count() ;
+                    _incr._nold.push_tail(_npos) ;
+                }
+                else
+                if (_incr._nmrk[_npos] == +2)
+                {
+                    _incr._ndel.push_tail(_npos) ;
+                }
+
+                if (_incr._nmrk[_npos] <= +2)
+                    _incr._nmrk[_npos] += +2 ;
+            }
+        }
+
+        if (_incr._eint.empty() &&
+            _incr._eout.empty() )
+        {
+            _incr._fail = "cavity has no bnd." ;
+            return false ;
+        }
+
+    /*-------------------- GEOM: bnd. of cavity, by tag */
+        _sgeo._ndim = +2 ;
+        _sgeo._kind =
+            jmsh_kind::euclidean_mesh ;
+
+        auto &_gsub = _sgeo._euclidean_mesh_2d ;
+        auto &_gnew = _geom._euclidean_mesh_2d ;
+
+        containers::array <
+        typename incr_data::gvtx_data> _gsrt ;
+
+        for (auto _iter  = _incr._nold.head() ;
+                  _iter != _incr._nold.tend() ;
+                ++_iter  )
+        {
+            typename geom_data::
+                euclidean_mesh_2d::node_type _ndat ;
+            _ndat.pval(0) =
+                _tria.node(*_iter).pval(0) ;
+            _ndat.pval(1) =
+                _tria.node(*_iter).pval(1) ;
+            _ndat.itag () = +0 ;
+
+            _gsub._tria.push_node(_ndat, false) ;
+        }
+
+        for (auto _ipos = +0 ; _ipos <
+            (iptr_type)_incr._eint.count() ;
+                  _ipos += +3)
+        {
+            auto _iter = &_incr._eint[_ipos] ;
+
+            typename geom_data::
+                euclidean_mesh_2d::edge_type _edat ;
+            _edat.node(0) = _incr._nmap[_iter[0]] ;
+            _edat.node(1) = _incr._nmap[_iter[1]] ;
+            _edat.itag () = _incr._itag ;
+
+            _gsub._tria.push_edge(_edat, false) ;
+        }
+
+        for (auto _ipos = +0 ; _ipos <
+            (iptr_type)_incr._eout.count() ;
+                  _ipos += +3)
+        {
+            auto _iter = &_incr._eout[_ipos] ;
+
+            real_type *_apos =
+               &_tria.node(_iter[0]).pval(0) ;
+            real_type *_bpos =
+               &_tria.node(_iter[1]).pval(0) ;
+            real_type *_cpos = &_tria.node(
+            _incr._ebnd[_ipos / 3 * 2 + 1]).pval(0) ;
+
+    /*-------------------- GEOM nodes between end-points */
+            incr_gvtx(_geom, _incr,
+                _incr._ebnd[_ipos / 3 * 2 + 0],
+                    _apos, _bpos, _cpos, _gsrt) ;
+
+            iptr_type _inod =
+                _incr._nmap[_iter[0]] ;
+            real_type*_ppos = _apos ;
+
+            for (auto _gpos  = _gsrt.head() ;
+                      _gpos != _gsrt.tend() ;
+                    ++_gpos  )
+            {
+                real_type *_qpos = &_gnew.
+                    _tria.node(_gpos->_node).pval(0) ;
+
+                typename geom_data::
+                euclidean_mesh_2d::node_type _ndat ;
+                _ndat.pval(0) = _qpos[0] ;
+                _ndat.pval(1) = _qpos[1] ;
+                _ndat.itag () = +0 ;
+
+                iptr_type _jnod =
+                _gsub._tria.push_node(_ndat, false) ;
+
+                typename geom_data::
+                euclidean_mesh_2d::edge_type _edat ;
+                _edat.node(0) = _inod ;
+                _edat.node(1) = _jnod ;
+                _edat.itag () = _iter[2] ;
+
+                _gsub._tria.push_edge(_edat, false) ;
+
+                _incr._aerr += std::abs(
+                    geometry::tria_area_2d (
+                        _apos, _ppos, _qpos)) ;
+
+                _inod = _jnod ; _ppos = _qpos ;
+            }
+
+            typename geom_data::
+                euclidean_mesh_2d::edge_type _edat ;
+            _edat.node(0) = _inod ;
+            _edat.node(1) = _incr._nmap[_iter[1]] ;
+            _edat.itag () = _iter[2] ;
+
+            _gsub._tria.push_edge(_edat, false) ;
+
+            _incr._aerr += std::abs(
+                geometry::tria_area_2d (
+                    _apos, _ppos, _bpos)) ;
+        }
+
+        _sgeo.init_geom(_jcfg) ;
+
+    /*-------------------- INIT: kept nodes + fixed edges */
+        _sini._ndim = +2 ;
+        _sini._kind =
+            jmsh_kind::euclidean_mesh ;
+
+        auto &_isub =
+            _sini._euclidean_mesh_2d._mesh;
+
+        for (auto _iter  = _incr._nold.head() ;
+                  _iter != _incr._nold.tend() ;
+                ++_iter  )
+        {
+            typename mesh_data::
+                euclidean_mesh_2d::
+            mesh_type::node_type _ndat ;
+            _ndat.pval(0) =
+                _tria.node(*_iter).pval(0) ;
+            _ndat.pval(1) =
+                _tria.node(*_iter).pval(1) ;
+            _ndat.pval(2) = (real_type)+0. ;
+
+            _ndat.hidx () = -1 ;
+            _ndat.itag () = -1 ;
+            _ndat.fdim () = +0 ;
+            _ndat.feat () = mesh::user_feat ;
+
+            _isub.push_node(_ndat, false) ;
+        }
+
+        for (auto _ipos = +0 ; _ipos <
+            (iptr_type)_incr._eint.count() ;
+                  _ipos += +3)
+        {
+            auto _iter = &_incr._eint[_ipos] ;
+
+            typename mesh_data::
+                euclidean_mesh_2d::
+            mesh_type::edge_type _edat ;
+            _edat.node(0) = _incr._nmap[_iter[0]] ;
+            _edat.node(1) = _incr._nmap[_iter[1]] ;
+            _edat.itag () = -1 ;
+
+            _isub.push_edge(_edat, false) ;
+        }
+
+        _isub.make_link() ;
+
+        return true ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-PICK: match + check the re-meshed cavity.
+    --------------------------------------------------------
+     */
+
+    // Interface edges are not refined, so the rDT may
+    // keep cells just outside of them: cells are kept
+    // only if their centroids are inside the sub. GEOM.
+    // Maps nodes of the sub-mesh on to kept INIT nodes,
+    // by exact position, and checks that the sub-mesh
+    // fills the cavity: same area (up to the re-formed
+    // outer bnd.), each kept node used, and each
+    // interface edge left un-split.
+    // Returns FALSE if the sub-mesh doesn't conform.
+
+    __normal_call bool_type incr_pick (
+        mesh_data &_mesh ,
+        geom_data &_sgeo ,
+        mesh_data &_smsh ,
+        incr_data &_incr
+        )
+    {
+        typedef mesh_data::euclidean_mesh_2d::
+                mesh_type          mesh_type ;
+
+        class node_sort
+            {
+            public  :
+            real_type           _ppos[2] ;
+            iptr_type           _inum ;
+            } ;
+
+        class node_less
+            {
+            public  :
+    /*------------------------ lexicographic on (x, y) */
+            __inline_call
+                bool_type operator () (
+                node_sort const&_idat ,
+                node_sort const&_jdat
+                ) const
+            {
+                if (_idat._ppos[0] !=
+                    _jdat._ppos[0] )
+                return _idat._ppos[0] <
+                       _jdat._ppos[0] ;
+                else
+                return _idat._ppos[1] <
+                       _jdat._ppos[1] ;
+            }
+            } ;
+
+        auto &_tria =
+            _mesh._euclidean_mesh_2d._mesh;
+        auto &_tsub =
+            _smsh._euclidean_mesh_2d._mesh;
+
+        typename mesh_type::connector _conn ;
+
+    /*-------------------- sort kept nodes by position */
+        containers::array<node_sort> _sort ;
+
+        for (auto _inum = +0 ; _inum <
+            (iptr_type)_incr._nold.count() ;
+                ++_inum )
+        {
+            auto _npos = _incr._nold[_inum] ;
+
+            node_sort _ndat ;
+            _ndat._ppos[0] =
+                _tria.node(_npos).pval(0) ;
+            _ndat._ppos[1] =
+                _tria.node(_npos).pval(1) ;
+            _ndat._inum = _inum ;
+
+            _sort.push_tail(_ndat) ;
+        }
+
+        algorithms::qsort(_sort.head() ,
+                          _sort.tend() ,
+            node_less() ) ;
+
+    /*-------------------- drop cells outside of cavity */
+        for (auto _tpos = +0 ; _tpos <
+            (iptr_type)_tsub.tri3().count() ;
+                ++_tpos )
+        {
+            auto &_tdat = _tsub.tri3(_tpos) ;
+
+            if (_tdat.mark() < +0) continue ;
+
+            real_type _pmid[2] = {
+                (real_type)+0., (real_type)+0.} ;
+
+            for (auto _inum = +3; _inum-- != +0; )
+            {
+                _pmid[0] += _tsub.node(
+                    _tdat.node(_inum)).pval(0) / 3. ;
+                _pmid[1] += _tsub.node(
+                    _tdat.node(_inum)).pval(1) / 3. ;
+            }
+
+            if (_sgeo._euclidean_mesh_2d.
+                    is_inside(_pmid) < +0)
+                _tsub._pop_tri3(_tpos) ;
+        }
+
+    /*-------------------- map sub-mesh nodes to kept */
+        _incr._smap.set_count(+0) ;
+        _incr._nsub.set_count(+0) ;
+
+        _incr._smap.set_count(_incr._nold.count(),
+            containers::tight_alloc, -1) ;
+        _incr._nsub.set_count(_tsub.node().count(),
+            containers::tight_alloc, -1) ;
+
+        typename incr_data::flag_list _used (
+            _tsub.node().count(), +0) ;
+
+        real_type _area = (real_type)+0. ;
+
+        for (auto _iter  = _tsub.tri3().head() ;
+                  _iter != _tsub.tri3().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() < +0) continue ;
+
+            _used[_iter->node(0)] = +1 ;
+            _used[_iter->node(1)] = +1 ;
+            _used[_iter->node(2)] = +1 ;
+
+            _area += std::abs(
+                geometry::tria_area_2d (
+           &_tsub.node(_iter->node(0)).pval(0) ,
+           &_tsub.node(_iter->node(1)).pval(0) ,
+           &_tsub.node(_iter->node(2)).pval(0))) ;
+        }
+
+        real_type static const _ATOL =
+            (real_type) +1.0E-08 ;
+
+        if (std::abs(_area - _incr._area) >
+                _ATOL * _incr._area + _incr._aerr)
+        {
+            _incr._fail = "sub-mesh area differs" ;
+            return false ;
+        }
+
+        iptr_type _nnum = +0 ;
+        for (auto _npos = +0 ; _npos <
+            (iptr_type)_tsub.node().count() ;
+                ++_npos )
+        {
+            if (_used[_npos] == +0) continue ;
+
+            node_sort _ndat ;
+            _ndat._ppos[0] =
+                _tsub.node(_npos).pval(0) ;
+            _ndat._ppos[1] =
+                _tsub.node(_npos).pval(1) ;
+
+            node_sort *_head = &_sort[0] ;
+            node_sort *_tend =
+                _head + _sort.count() ;
+
+            auto _iter = std::lower_bound(
+                _head, _tend, _ndat, node_less()) ;
+
+            if (_iter == _tend) continue ;
+
+            if (_iter->_ppos[0] != _ndat._ppos[0] ||
+                _iter->_ppos[1] != _ndat._ppos[1] )
+                continue ;
+
+            if (_incr._smap[_iter->_inum] != -1)
+            {
+                _incr._fail = "kept node duplicated" ;
+                return false ;
+            }
+
+            _incr._smap[_iter->_inum] = _npos ;
+            _incr._nsub[_npos] =
+                _incr._nold[_iter->_inum] ;
+
+            _nnum += +1 ;
+        }
+
+        if (_nnum !=
+            (iptr_type)_incr._nold.count())
+        {
+            _incr._fail = "kept node not used" ;
+            return false ;
+        }
+
+    /*-------------------- interface edges: one cell */
+        for (auto _ipos = +0 ; _ipos <
+            (iptr_type)_incr._eint.count() ;
+                  _ipos += +3)
+        {
+            auto _iter = &_incr._eint[_ipos] ;
+
+            iptr_type _enod[2], _eidx = -1 ;
+            _enod[0] = _incr._smap[
+                _incr._nmap[_iter[0]]] ;
+            _enod[1] = _incr._smap[
+                _incr._nmap[_iter[1]]] ;
+
+            if (!_tsub.find_edge(_enod, _eidx))
+            {
+                _incr._fail = "interface edge split" ;
+                return false ;
+            }
+
+            _conn.set_count(+0) ;
+            _tsub.connect_2(
+                _eidx, mesh::EDGE2_tag, _conn) ;
+
+            if (_conn.count() != +1)
+            {
+                _incr._fail = "interface edge not bnd." ;
+                return false ;
+            }
+        }
+
+    /*-------------------- bnd. edges: interface or GEOM */
+        iptr_type _nbnd = +0, _ngeo = +0 ;
+
+        for (auto _epos = +0 ; _epos <
+            (iptr_type)_tsub.edge().count() ;
+                ++_epos )
+        {
+            auto &_edat = _tsub.edge(_epos) ;
+
+            if (_edat.mark() < +0) continue ;
+
+            _conn.set_count(+0) ;
+            _tsub.connect_2(
+                _epos, mesh::EDGE2_tag, _conn) ;
+
+            if (_conn.count() >= +3)
+            {
+                _incr._fail = "non-manifold sub-mesh" ;
+                return false ;
+            }
+
+            if (_conn.count() != +1) continue ;
+
+            _nbnd += +1 ;
+
+            if (_edat.self() >= +1 &&
+                _edat.itag() != _incr._itag)
+            _ngeo += +1 ;
+        }
+
+        if (_nbnd != _ngeo + (iptr_type)
+            _incr._eint.count() / 3)
+        {
+            _incr._fail = "sub-mesh bnd. differs" ;
+            return false ;
+        }
+
+        return true ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * INCR-PUSH: splice re-meshed cavity into the INIT.
+    --------------------------------------------------------
+     */
+
+    // Cavity cells and interior nodes are deleted in-place,
+    // so that frozen cells + nodes are left untouched.
+    // Cell + node flags are grown to fit, so that parts
+    // still to do can be re-meshed in the updated INIT.
+
+    __normal_call void_type incr_push (
+        mesh_data &_mesh ,
+        mesh_data &_smsh ,
+        incr_data &_incr
+        )
+    {
+        typedef mesh_data::euclidean_mesh_2d::
+                mesh_type          mesh_type ;
+
+        auto &_tria =
+            _mesh._euclidean_mesh_2d._mesh;
+        auto &_tsub =
+            _smsh._euclidean_mesh_2d._mesh;
+
+    /*-------------------- delete cavity cells + nodes */
+        for (auto _iter  = _incr._tcav.head() ;
+                  _iter != _incr._tcav.tend() ;
+                ++_iter  )
+        {
+            _tria._pop_tri3(*_iter) ;
+        }
+
+        for (auto _iter  = _incr._eold.head() ;
+                  _iter != _incr._eold.tend() ;
+                ++_iter  )
+        {
+            _tria._pop_edge(*_iter) ;
+        }
+
+        for (auto _iter  = _incr._ndel.head() ;
+                  _iter != _incr._ndel.tend() ;
+                ++_iter  )
+        {
+            _tria._pop_node(&*_iter) ;
+        }
+
+    /*-------------------- push new nodes into the INIT */
+        _incr._nsub.set_count(_tsub.node().count(),
+            containers::loose_alloc, -1) ;
+
+        for (auto _iter  = _tsub.tri3().head() ;
+                  _iter != _tsub.tri3().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() < +0) continue ;
+
+            for (auto _inum = +3; _inum-- != +0; )
+            {
+                auto  _npos = _iter->node(_inum) ;
+
+                if (_incr._nsub[_npos] != -1)
+                    continue ;
+
+                typename
+                mesh_type::node_type _ndat ;
+                _ndat.pval(0) =
+                _tsub.node(_npos).pval(0) ;
+                _ndat.pval(1) =
+                _tsub.node(_npos).pval(1) ;
+                _ndat.pval(2) =
+                _tsub.node(_npos).pval(2) ;
+
+                _ndat.hidx () =
+                _tsub.node(_npos).hidx () ;
+                _ndat.itag () =
+                _tsub.node(_npos).itag () ;
+                _ndat.fdim () =
+                _tsub.node(_npos).fdim () ;
+                _ndat.feat () =
+                _tsub.node(_npos).feat () ;
+
+                _incr._nsub[_npos] =
+                    _tria.push_node(_ndat) ;
+            }
+        }
+
+    /*-------------------- push new cells into the INIT */
+        for (auto _iter  = _tsub.tri3().head() ;
+                  _iter != _tsub.tri3().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() < +0) continue ;
+
+            typename mesh_type::tri3_type _tdat ;
+            _tdat.node(0) =
+                _incr._nsub[_iter->node(0)] ;
+            _tdat.node(1) =
+                _incr._nsub[_iter->node(1)] ;
+            _tdat.node(2) =
+                _incr._nsub[_iter->node(2)] ;
+
+            _tdat.itag () = _incr._ttag ;
+
+            _tria.push_tri3(_tdat) ;
+        }
+
+        for (auto _iter  = _tsub.edge().head() ;
+                  _iter != _tsub.edge().tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() < +0) continue ;
+            if (_iter->self() < +1) continue ;
+
+            if (_iter->itag() == _incr._itag)
+                continue ;
+
+            typename mesh_type::edge_type _edat ;
+            _edat.node(0) =
+                _incr._nsub[_iter->node(0)] ;
+            _edat.node(1) =
+                _incr._nsub[_iter->node(1)] ;
+
+            _edat.itag () = _iter->itag () ;
+
+            _tria.push_edge(_edat) ;
+        }
+
+    /*-------------------- grow flags for any new cells */
+        _incr._tmrk.set_count(_tria.tri3().count(),
+            containers::loose_alloc, +0) ;
+        _incr._nmrk.set_count(_tria.node().count(),
+            containers::loose_alloc, +0) ;
+        _incr._nmap.set_count(_tria.node().count(),
+            containers::loose_alloc, -1) ;
+    }
+
+
+#   endif//__MSH_INCR__
+
+
+
@@ -176,6 +176,205 @@
         ) { }
     } ;
 
+    /*
+    --------------------------------------------------------
+     * BINARY *.MSH files, "MSHID=3;...;BINARY" (version 1)
+    --------------------------------------------------------
+     *
+     * Each section keeps its text header line, padded with
+     * blanks so that the raw block following it begins on
+     * an 8-byte offset. Blocks are little-endian, with
+     * reals stored as float64 and indexing as int32:
+     *
+     * POINT=NP     float64 [NP x NDIMS], int32 [NP] (itag)
+     * SEEDS=NP     as for POINT
+     * COORD=ID;NC  float64 [NC]
+     * POWER=NP;NV  float64 [NP x NV]
+     * VALUE=NP;NV  float64 [NP x NV]
+     * SLOPE=NP;NV  float64 [NP x NV]
+     * EDGE2=NE     int32 [NE x 3]   (node x 2, itag)
+     * TRIA3=NT     int32 [NT x 4]   (node x 3, itag)
+     * QUAD4=NQ     int32 [NQ x 5]
+     * TRIA4=NT     int32 [NT x 5]
+     * HEXA8=NH     int32 [NH x 9]
+     * WEDG6=NW     int32 [NW x 7]
+     * PYRA5=NP     int32 [NP x 6]
+     * BOUND=NB     int32 [NB x 3]   (itag, inum, kind)
+     *
+     * Arrays are row-major. All other sections (MSHID,
+     * NDIMS, RADII) are identical to the ascii format.
+    --------------------------------------------------------
+     */
+
+    __inline_call bool_type bins_little (
+        )
+    {
+        std::uint16_t _word = +1 ;
+        char_type     _byte = +0 ;
+        std::memcpy(&_byte, &_word, +1) ;
+
+        return ( _byte == +1 ) ;
+    }
+
+    template <
+        typename  data_type
+             >
+    __inline_call data_type bins_load (
+        char_type const*_bptr
+        )
+    {
+    /*--------------- load LE. value from unaligned bytes */
+        data_type _data ;
+        char_type*_dptr = (char_type*)&_data ;
+
+        if (bins_little())
+        {
+            std::memcpy(
+                _dptr, _bptr, sizeof(data_type)) ;
+        }
+        else
+        {
+            for (auto _ipos = sizeof(data_type) ;
+                      _ipos-- != +0 ; )
+               *_dptr++ = _bptr[_ipos] ;
+        }
+
+        return ( _data ) ;
+    }
+
+    template <
+        typename  data_type
+             >
+    __inline_call void_type bins_save (
+        char_type      *_bptr ,
+        data_type const&_data
+        )
+    {
+    /*--------------- save LE. value into unaligned bytes */
+        char_type const*_dptr =
+            (char_type const*)&_data ;
+
+        if (bins_little())
+        {
+            std::memcpy(
+                _bptr, _dptr, sizeof(data_type)) ;
+        }
+        else
+        {
+            for (auto _ipos = sizeof(data_type) ;
+                      _ipos-- != +0 ; )
+               *_bptr++ = _dptr[_ipos] ;
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * FILE-MMAP: read-only view of a whole file.
+    --------------------------------------------------------
+     */
+
+    class file_mmap
+    {
+    public  :
+
+    char_type const*        _head = nullptr ;
+    std:: size_t            _size = +0 ;
+
+    bool_type               _mmap = false ;
+
+    containers::array<char_type> _copy ;
+
+    public  :
+
+    __normal_call ~file_mmap (
+        )
+    {
+        free () ;
+    }
+
+    __normal_call void_type free (
+        )
+    {
+#       ifdef  __use_mmap
+        if (this->_mmap)
+        {
+            ::munmap((void *)this->_head,
+                             this->_size) ;
+        }
+#       endif//__use_mmap
+
+        this->_copy.clear(
+            containers::tight_alloc) ;
+
+        this->_head = nullptr ;
+        this->_size = +0 ;
+        this->_mmap = false ;
+    }
+
+    __normal_call bool_type open (
+        std::string const&_fstr
+        )
+    {
+        free () ;
+
+#       ifdef  __use_mmap
+    /*--------------- map file pages directly, if allowed */
+        int _fdes = ::open(_fstr.c_str(), O_RDONLY) ;
+
+        if (_fdes < +0) return false ;
+
+        struct stat _stat ;
+        if (::fstat(_fdes, &_stat) == +0 &&
+                _stat.st_size > +0)
+        {
+            void  *_addr = ::mmap(nullptr,
+                (std::size_t)_stat.st_size ,
+                PROT_READ, MAP_PRIVATE, _fdes, 0) ;
+
+            if (_addr != MAP_FAILED)
+            {
+                this->_head =
+                    (char_type const*)_addr ;
+                this->_size =
+                    (std::size_t)_stat.st_size ;
+                this->_mmap = true ;
+            }
+        }
+
+        ::close(_fdes) ;
+
+        if (this->_mmap) return true ;
+#       endif//__use_mmap
+
+    /*--------------- otherwise, buffer the whole file in */
+        std::ifstream _file(_fstr,
+            std::ifstream::in |
+            std::ifstream::binary) ;
+
+        if (!_file.is_open()) return false ;
+
+        _file.seekg(0, std::ifstream::end) ;
+        std::streamoff _fend = _file.tellg();
+        _file.seekg(0, std::ifstream::beg) ;
+
+        if (_fend > +0)
+        {
+            this->_copy.set_count(
+           (std::size_t)_fend,
+                containers::tight_alloc) ;
+
+            _file.read(&this->_copy[0], _fend) ;
+
+            this->_head = &this->_copy[0] ;
+            this->_size =
+                (std::size_t)_file.gcount() ;
+        }
+
+        return true ;
+    }
+
+    } ;
+
     /*
     --------------------------------------------------------
      * JMSH-READER: read *.MSH mesh files
@@ -196,6 +395,8 @@
 
     jmsh_kind::enum_data    _kind ;
 
+    bool_type               _bins ;
+
     public  :
 
     /*
@@ -205,10 +406,11 @@
      */
 
     template <
+        typename  file_type ,
         typename  dest_type
              >
     __normal_call void_type read_mshid (
-        std::ifstream &_ffid,
+        file_type     &_ffid,
         string_tokens &_stok,
         dest_type     &_dest
         )
@@ -226,7 +428,8 @@
                          ) ;
         }
         else
-        if (_stok.count() == +3)
+        if (_stok.count() == +3 ||
+            _stok.count() == +4)
         {
 
         this->_ftag = std::stol(_stok[1]) ;
@@ -272,6 +475,19 @@
             push_tail("Invalid MSHID!") ;
         }
 
+        if (_stok.count() == +4)
+        {
+        if (_stok[3] == "BINARY")
+        {
+            this->_bins = true ;
+        }
+        else
+        {
+            this->_errs.
+            push_tail("Invalid MSHID!") ;
+        }
+        }
+
         _dest.push_mshid(this->_ftag ,
                          this->_kind
                          ) ;
@@ -291,10 +507,11 @@
      */
 
     template <
+        typename  file_type ,
         typename  dest_type
              >
     __normal_call void_type read_ndims (
-        std::ifstream &_ffid,
+        file_type     &_ffid,
         string_tokens &_stok,
         dest_type     &_dest
         )
@@ -323,10 +540,11 @@
      */
 
     template <
+        typename  file_type ,
         typename  dest_type
              >
     __normal_call void_type read_radii (
-        std::ifstream &_ffid,
+        file_type     &_ffid,
         string_tokens &_stok,
         dest_type     &_dest
         )
@@ -1307,6 +1525,356 @@
         }
     }
 
+    /*
+    --------------------------------------------------------
+     * BINS-SIZE: byte size of a binary data section
+    --------------------------------------------------------
+     */
+
+    __normal_call bool_type bins_size (
+        string_tokens &_stok,
+        std:: size_t  &_size
+        )
+    {
+        std:: size_t _nrow = +0 ;
+        std:: size_t _ncol = +0 ;
+
+        _size = +0 ;
+
+        if (_stok[0] == "POINT" ||
+            _stok[0] == "SEEDS" )
+        {
+            if (_stok.count() == +2)
+            _nrow = std::stol(_stok[1]) ;
+
+            _size = _nrow * (
+                this->_ndim * sizeof(double) +
+                              sizeof(std::int32_t)) ;
+        }
+        else
+        if (_stok[0] == "COORD")
+        {
+            if (_stok.count() == +3)
+            _nrow = std::stol(_stok[2]) ;
+
+            _size = _nrow * sizeof(double) ;
+        }
+        else
+        if (_stok[0] == "POWER" ||
+            _stok[0] == "VALUE" ||
+            _stok[0] == "SLOPE" )
+        {
+            if (_stok.count() == +3)
+            {
+            _nrow = std::stol(_stok[1]) ;
+            _ncol = std::stol(_stok[2]) ;
+            }
+
+            _size = _nrow * _ncol * sizeof(double) ;
+        }
+        else
+        {
+            if (_stok[0] == "EDGE2") _ncol = +3 ;
+            else
+            if (_stok[0] == "TRIA3") _ncol = +4 ;
+            else
+            if (_stok[0] == "QUAD4") _ncol = +5 ;
+            else
+            if (_stok[0] == "TRIA4") _ncol = +5 ;
+            else
+            if (_stok[0] == "HEXA8") _ncol = +9 ;
+            else
+            if (_stok[0] == "WEDG6") _ncol = +7 ;
+            else
+            if (_stok[0] == "PYRA5") _ncol = +6 ;
+            else
+            if (_stok[0] == "BOUND") _ncol = +3 ;
+            else
+                return false ;      // not a data block
+
+            if (_stok.count() == +2)
+            _nrow = std::stol(_stok[1]) ;
+
+            _size = _nrow * _ncol *
+                    sizeof(std::int32_t) ;
+        }
+
+        return true  ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * READ-BINS: read binary data section from bytes
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  dest_type
+             >
+    __normal_call void_type read_bins (
+        char_type const*_bptr ,
+        string_tokens  &_stok ,
+        dest_type      &_dest
+        )
+    {
+        std:: size_t static
+            constexpr _VMAX = +256 ;
+
+        if (_stok[0] == "POINT" ||
+            _stok[0] == "SEEDS" )
+        {
+    /*----------------------------------------- read head */
+        std:: size_t _nrow = +0;
+        if (_stok.count() == +2 &&
+            this->_ndim <= _VMAX)
+        {
+            _nrow = std::stol(_stok[1]);
+        }
+        else
+        {
+            this->_errs.push_tail(
+                "Invalid " + _stok[0] + "!") ;
+        }
+
+        bool_type _seed = _stok[0] == "SEEDS";
+
+        if (_seed)
+            _dest.open_seeds(_nrow) ;
+        else
+            _dest.open_point(_nrow) ;
+
+    /*----------------------------------------- read data */
+        char_type const*_tptr = _bptr +
+            _nrow * this->_ndim * sizeof(double) ;
+
+        for (auto _irow = +0u ;
+                  _irow < _nrow ; ++_irow)
+        {
+            double _pval [_VMAX] ;
+            for (auto _ipos = +0u ;
+                _ipos < this->_ndim; ++_ipos)
+            {
+                _pval[_ipos] =
+                    bins_load<double>(_bptr) ;
+
+                _bptr += sizeof (double) ;
+            }
+
+            std::int32_t _itag =
+                bins_load<std::int32_t>(_tptr) ;
+
+            _tptr += sizeof (std::int32_t) ;
+
+            if (_seed)
+            _dest.push_seeds(_irow, _pval, _itag) ;
+            else
+            _dest.push_point(_irow, _pval, _itag) ;
+        }
+        }
+        else
+        if (_stok[0] == "COORD")
+        {
+    /*----------------------------------------- read head */
+        std:: size_t _nrow = +0;
+        std:: size_t _idim = +0;
+        if (_stok.count() == +3)
+        {
+            _idim = std::stol(_stok[1]);
+            _nrow = std::stol(_stok[2]);
+        }
+        else
+        {
+            this->_errs.
+            push_tail("Invalid COORD!");
+        }
+
+        _dest.open_coord(_idim, _nrow) ;
+
+    /*----------------------------------------- read data */
+        for (auto _irow = +0u ;
+                  _irow < _nrow ; ++_irow)
+        {
+            _dest.push_coord(_idim, _irow,
+                bins_load<double>(_bptr)) ;
+
+            _bptr += sizeof (double) ;
+        }
+        }
+        else
+        if (_stok[0] == "POWER" ||
+            _stok[0] == "VALUE" ||
+            _stok[0] == "SLOPE" )
+        {
+    /*----------------------------------------- read head */
+        std:: size_t _nrow = +0;
+        std:: size_t _nval = +0;
+        if (_stok.count() == +3 &&
+                std::stol(_stok[2])
+                    <= (long)_VMAX)
+        {
+            _nrow = std::stol(_stok[1]);
+            _nval = std::stol(_stok[2]);
+        }
+        else
+        {
+            this->_errs.push_tail(
+                "Invalid " + _stok[0] + "!") ;
+        }
+
+        if (_stok[0] == "POWER")
+            _dest.open_power(_nrow, _nval) ;
+        else
+        if (_stok[0] == "VALUE")
+            _dest.open_value(_nrow, _nval) ;
+        else
+            _dest.open_slope(_nrow, _nval) ;
+
+    /*----------------------------------------- read data */
+        for (auto _irow = +0u ;
+                  _irow < _nrow ; ++_irow)
+        {
+            double _vval [_VMAX] ;
+            for (auto _ipos = +0u ;
+                      _ipos < _nval; ++_ipos)
+            {
+                _vval[_ipos] =
+                    bins_load<double>(_bptr) ;
+
+                _bptr += sizeof (double) ;
+            }
+
+            if (_stok[0] == "POWER")
+                _dest.push_power(_irow, _vval) ;
+            else
+            if (_stok[0] == "VALUE")
+                _dest.push_value(_irow, _vval) ;
+            else
+                _dest.push_slope(_irow, _vval) ;
+        }
+        }
+        else
+        {
+    /*----------------------------------------- read head */
+        std:: size_t _nrow = +0;
+        std:: size_t _size = +0;
+        if (_stok.count() == +2 &&
+                bins_size(_stok, _size))
+        {
+            _nrow = std::stol(_stok[1]);
+        }
+        else
+        {
+            this->_errs.push_tail(
+                "Invalid " + _stok[0] + "!") ;
+
+            return ;
+        }
+
+        std:: size_t _ncol = _nrow > +0 ?
+            _size / (_nrow *
+                sizeof(std::int32_t)) : +0 ;
+
+        if (_stok[0] == "EDGE2")
+            _dest.open_edge2(_nrow) ;
+        else
+        if (_stok[0] == "TRIA3")
+            _dest.open_tria3(_nrow) ;
+        else
+        if (_stok[0] == "QUAD4")
+            _dest.open_quad4(_nrow) ;
+        else
+        if (_stok[0] == "TRIA4")
+            _dest.open_tria4(_nrow) ;
+        else
+        if (_stok[0] == "HEXA8")
+            _dest.open_hexa8(_nrow) ;
+        else
+        if (_stok[0] == "WEDG6")
+            _dest.open_wedg6(_nrow) ;
+        else
+        if (_stok[0] == "PYRA5")
+            _dest.open_pyra5(_nrow) ;
+        else
+            _dest.open_bound(_nrow) ;
+
+    /*----------------------------------------- read data */
+        for (auto _irow = +0u ;
+                  _irow < _nrow ; ++_irow)
+        {
+            std::int32_t _ival [ +9] ;
+            for (auto _ipos = +0u ;
+                      _ipos < _ncol; ++_ipos)
+            {
+                _ival[_ipos] =
+                bins_load<std::int32_t>(_bptr) ;
+
+                _bptr += sizeof (std::int32_t) ;
+            }
+
+            std::int32_t _itag = _ival[_ncol-1] ;
+
+            if (_stok[0] == "EDGE2")
+            _dest.push_edge2(_irow, _ival, _itag) ;
+            else
+            if (_stok[0] == "TRIA3")
+            _dest.push_tria3(_irow, _ival, _itag) ;
+            else
+            if (_stok[0] == "QUAD4")
+            _dest.push_quad4(_irow, _ival, _itag) ;
+            else
+            if (_stok[0] == "TRIA4")
+            _dest.push_tria4(_irow, _ival, _itag) ;
+            else
+            if (_stok[0] == "HEXA8")
+            _dest.push_hexa8(_irow, _ival, _itag) ;
+            else
+            if (_stok[0] == "WEDG6")
+            _dest.push_wedg6(_irow, _ival, _itag) ;
+            else
+            if (_stok[0] == "PYRA5")
+            _dest.push_pyra5(_irow, _ival, _itag) ;
+            else
+            _dest.push_bound(_irow,
+                _ival[0], _ival[1], _ival[2]) ;
+        }
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * READ-BINS: read binary data section from stream
+    --------------------------------------------------------
+     */
+
+    template <
+        typename  dest_type
+             >
+    __normal_call void_type read_bins (
+        std::ifstream  &_ffid ,
+        string_tokens  &_stok ,
+        std:: size_t    _size ,
+        dest_type      &_dest
+        )
+    {
+        containers::array<char_type> _bbuf ;
+        _bbuf.set_count(std::max(
+            _size, (std::size_t)+1) ,
+                containers::tight_alloc) ;
+
+        _ffid.read(&_bbuf[0], _size) ;
+
+        if ((std::size_t)
+                _ffid.gcount() != _size)
+        {
+            this->_errs.push_tail(
+                "Truncated " + _stok[0] + "!") ;
+        }
+        else
+        {
+            read_bins(&_bbuf[0], _stok, _dest) ;
+        }
+    }
+
     /*
     --------------------------------------------------------
      * READ-FILE: read *.MSH file into MESH
@@ -1323,6 +1891,7 @@
     {
         this->_ftag = -1 ;
         this->_ndim = +0 ;
+        this->_bins = false ;
 
         std::string _line;
         while (std::getline(_ffid, _line))
@@ -1351,6 +1920,14 @@
         /*---------------------------- trim on each token */
             *_iter = trim( *_iter ) ;
 
+            std:: size_t _size = +0 ;
+
+            if (this->_bins &&
+                    bins_size(_stok, _size))
+                {
+            read_bins(_ffid, _stok, _size, _dest) ;
+                }
+            else
             if (_stok[0] == "MSHID")
                 {
             read_mshid(_ffid, _stok, _dest) ;
@@ -1444,6 +2021,147 @@
         }
     }
 
+    /*
+    --------------------------------------------------------
+     * READ-FILE: read *.MSH file into MESH, given a path
+    --------------------------------------------------------
+     */
+
+    __normal_call bool_type read_head (
+        char_type const*&_next,
+        char_type const* _tend,
+        string_tokens   &_stok
+        )
+    {
+    /*--------------- tokenise next non-blank header line */
+        while (_next < _tend)
+        {
+            char_type const*_stop =
+                std::find(_next, _tend, '\n') ;
+
+            std::string _line(_next, _stop) ;
+
+            _next = _stop < _tend ?
+                    _stop + 1 : _tend ;
+
+            _line = trim(_line) ;
+
+            if (_line.size() <= 0) continue ;
+            if (_line[ +0] == '#') continue ;
+
+            std::transform(_line.begin() ,
+                           _line.  end() ,
+                           _line.begin() ,
+            [](unsigned char c){ return
+              (unsigned char)::toupper(c); } ) ;
+
+            _stok.clear() ;
+
+            find_toks(_line, "=;", _stok);
+
+            for (auto _iter  = _stok.head() ;
+                      _iter != _stok.tend() ;
+                    ++_iter  )
+        /*---------------------------- trim on each token */
+            *_iter = trim( *_iter ) ;
+
+            if (_stok.count() > +0) return true ;
+        }
+
+        return false ;
+    }
+
+    template <
+        typename  dest_type
+             >
+    __normal_call bool_type read_file (
+        std::string const&_fstr ,
+        dest_type       &&_dest
+        )
+    {
+        this->_ftag = -1 ;
+        this->_ndim = +0 ;
+        this->_bins = false ;
+
+        file_mmap _fmap ;
+        if (!_fmap.open(_fstr)) return false ;
+
+        char_type const*_next = _fmap._head ;
+        char_type const*_tend =
+            _fmap._head + _fmap._size ;
+
+    /*--------------- test MSHID for binary data sections */
+        string_tokens _stok ;
+        if (!read_head(_next, _tend, _stok) ||
+                _stok[0] != "MSHID" ||
+                _stok.count() != +4 ||
+                _stok[3] != "BINARY" )
+        {
+    /*--------------- revert to the ascii parser if not */
+            _fmap.free() ;
+
+            std::ifstream _ffid ;
+            _ffid.open(
+                _fstr, std::ifstream::in) ;
+
+            if (!_ffid.is_open()) return false ;
+
+            read_file(_ffid, _dest) ;
+
+            return true ;
+        }
+
+    /*--------------- else, walk sections of mapped bytes */
+        _next = _fmap._head ;
+
+        while (read_head(_next, _tend, _stok))
+        {
+            try
+            {
+            std:: size_t _size = +0 ;
+
+            if (this->_bins &&
+                    bins_size(_stok, _size))
+                {
+            if (_size > (std::size_t)
+                        (_tend - _next))
+                {
+                this->_errs.push_tail(
+                    "Truncated " + _stok[0] + "!");
+                break ;
+                }
+
+            read_bins(_next, _stok, _dest) ;
+
+            _next += _size ;
+                }
+            else
+            if (_stok[0] == "MSHID")
+                {
+            read_mshid(_fmap, _stok, _dest) ;
+                }
+            else
+            if (_stok[0] == "NDIMS")
+                {
+            read_ndims(_fmap, _stok, _dest) ;
+                }
+            else
+            if (_stok[0] == "RADII")
+                {
+            read_radii(_fmap, _stok, _dest) ;
+                }
+
+            }
+            catch (...)
+            {
+                this->_errs.push_tail(_stok[0]) ;
+                break ;
+            }
+        }
+
+        return true ;
+    }
+
     } ;
 
 #   endif   //__MSH_READ__
@@ -86,6 +86,330 @@
             }                       \
         }
 
+    /*
+    --------------------------------------------------------
+     * BINS-WRITE: buffered binary *.MSH blocks, with
+     * the layout described in msh_read.hpp.
+    --------------------------------------------------------
+     */
+
+    class bins_write
+    {
+    public  :
+
+    std::ofstream          &_file ;
+
+    std:: size_t            _next = +0 ;
+    char_type               _fbuf[PRINTCHUNK] ;
+
+    public  :
+
+    __normal_call bins_write (
+        std::ofstream &_ffid
+        ) : _file(_ffid) {}
+
+    __normal_call ~bins_write (
+        )
+    {
+        flush () ;
+    }
+
+    __normal_call void_type flush (
+        )
+    {
+        if (this->_next > +0)
+        {
+            this->_file.write(
+                this->_fbuf, this->_next) ;
+        }
+        this->_next = +0 ;
+    }
+
+    __normal_call void_type head (
+        std::string const&_line
+        )
+    {
+    /*----------------- pad so that block is 8-byte align */
+        flush () ;
+
+        std:: size_t _fpos =
+       (std:: size_t)this->_file.tellp() ;
+
+        std:: size_t _fill = (+8 - (_fpos +
+            _line.size() + 1) % 8) % 8 ;
+
+        this->_file << _line
+                    << std::string(_fill, ' ')
+                    << "\n" ;
+    }
+
+    template <
+        typename  data_type
+             >
+    __inline_call void_type push (
+        data_type const&_data
+        )
+    {
+        if (this->_next +
+            sizeof(data_type) > PRINTCHUNK)
+            flush () ;
+
+        bins_save(&this->_fbuf[this->_next], _data);
+
+        this->_next += sizeof(data_type) ;
+    }
+
+    } ;
+
+    template <
+    typename      list_type
+             >
+    __normal_call void_type bins_point (
+        bins_write &_bins ,
+        list_type  &_list ,
+        containers::array<iptr_type> &_nmap ,
+        iptr_type   _nnum ,
+        iptr_type   _ndim
+        )
+    {
+    /*----------------- POINT block: coord. data, then tag */
+        _bins.head(
+            "POINT=" + std::to_string(_nnum)) ;
+
+        iptr_type _npos = +0 ;
+        for (auto _iter  = _list.head() ;
+                  _iter != _list.tend() ;
+                ++_iter, ++_npos)
+        {
+            if (_iter->mark() >= 0 &&
+                _nmap[_npos ] >= 0 )
+            {
+            for (auto _idim = +0 ;
+                      _idim < _ndim; ++_idim)
+                _bins.push(
+                    (double)_iter->pval(_idim)) ;
+            }
+        }
+
+        for (auto _inum = +0 ;
+                  _inum < _nnum; ++_inum)
+            _bins.push((std::int32_t) +0) ;
+    }
+
+    template <
+    typename      list_type
+             >
+    __normal_call void_type bins_power (
+        bins_write &_bins ,
+        list_type  &_list ,
+        containers::array<iptr_type> &_nmap ,
+        iptr_type   _nnum ,
+        iptr_type   _ipos
+        )
+    {
+    /*----------------- POWER block: node weights as NP x 1 */
+        _bins.head(
+            "POWER=" + std::to_string(_nnum) + ";1");
+
+        iptr_type _npos = +0 ;
+        for (auto _iter  = _list.head() ;
+                  _iter != _list.tend() ;
+                ++_iter, ++_npos)
+        {
+            if (_iter->mark() >= 0 &&
+                _nmap[_npos ] >= 0 )
+            {
+                _bins.push(
+                    (double)_iter->pval(_ipos)) ;
+            }
+        }
+    }
+
+    template <
+    typename      list_type
+             >
+    __normal_call void_type bins_cells (
+        bins_write &_bins ,
+        char const *_kind ,
+        list_type  &_list ,
+        containers::array<iptr_type> &_nmap ,
+        iptr_type   _ncel ,
+        iptr_type   _nnod
+        )
+    {
+    /*----------------- cell block from the mesh-complex */
+        _bins.head(std::string(_kind) +
+            "=" + std::to_string(_ncel)) ;
+
+        for (auto _iter  = _list.head() ;
+                  _iter != _list.tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() >= 0 &&
+                _iter->self() >= 1 )
+            {
+            for (auto _inod = +0 ;
+                      _inod < _nnod; ++_inod)
+            {
+                _bins.push((std::int32_t)
+                    _nmap[_iter->node(_inod)]) ;
+            }
+                _bins.push(
+                    (std::int32_t)_iter->itag()) ;
+            }
+        }
+    }
+
+    template <
+    typename      comp_type
+             >
+    __normal_call void_type bins_point (
+        bins_write &_bins ,
+        comp_type const&_comp ,
+        iptr_type   _ndim
+        )
+    {
+    /*----------------- POINT block from compact SoA data */
+        _bins.head(
+            "POINT=" + std::to_string(_comp._nnum)) ;
+
+        for (auto _npos = +0 ;
+                  _npos < _comp._nnum; ++_npos)
+        {
+            for (auto _idim = +0 ;
+                      _idim < _ndim; ++_idim)
+                _bins.push(
+                (double)_comp._pval[_idim][_npos]) ;
+        }
+
+        for (auto _inum = +0 ;
+                  _inum < _comp._nnum; ++_inum)
+            _bins.push((std::int32_t) +0) ;
+    }
+
+    template <
+    typename      comp_type
+             >
+    __normal_call void_type bins_power (
+        bins_write &_bins ,
+        comp_type const&_comp ,
+        iptr_type   _ipos
+        )
+    {
+    /*----------------- POWER block from compact SoA data */
+        _bins.head(
+            "POWER=" +
+                std::to_string(_comp._nnum) + ";1");
+
+        for (auto _npos = +0 ;
+                  _npos < _comp._nnum; ++_npos)
+        {
+            _bins.push(
+                (double)_comp._pval[_ipos][_npos]) ;
+        }
+    }
+
+    template <
+    typename      comp_type
+             >
+    __normal_call void_type bins_cells (
+        bins_write &_bins ,
+        char const *_kind ,
+        comp_type const&_comp ,
+        iptr_type   _ikind
+        )
+    {
+    /*----------------- cell block from compact cell list */
+        iptr_type _ncel = _comp._cnum[_ikind] ;
+        iptr_type _nnod =
+            comp_type::node_nums(_ikind) ;
+
+        _bins.head(std::string(_kind) +
+            "=" + std::to_string(_ncel)) ;
+
+        for (auto _cpos = +0 ;
+                  _cpos < _ncel; ++_cpos)
+        {
+            for (auto _inod = +0 ;
+                      _inod < _nnod; ++_inod)
+            {
+                _bins.push((std::int32_t)_comp.
+                _cnod[_ikind][_cpos * _nnod + _inod]) ;
+            }
+                _bins.push((std::int32_t)
+                    _comp._ctag[_ikind][_cpos]) ;
+        }
+    }
+
+    template <
+    typename      list_type
+             >
+    __normal_call void_type bins_tria (
+        bins_write &_bins ,
+        char const *_kind ,
+        list_type  &_list ,
+        containers::array<iptr_type> &_nmap ,
+        iptr_type   _ncel ,
+        iptr_type   _nnod
+        )
+    {
+    /*----------------- cell block from the Delaunay tria */
+        _bins.head(std::string(_kind) +
+            "=" + std::to_string(_ncel)) ;
+
+        for (auto _iter  = _list.head() ;
+                  _iter != _list.tend() ;
+                ++_iter  )
+        {
+            if (_iter->mark() < +0) continue ;
+
+            for (auto _inod = +0 ;
+                      _inod < _nnod; ++_inod)
+            {
+                _bins.push((std::int32_t)
+                    _nmap[_iter->node(_inod)]) ;
+            }
+                _bins.push((std::int32_t) +0) ;
+        }
+    }
+
+    template <
+    typename      hash_type
+             >
+    __normal_call void_type bins_hash (
+        bins_write &_bins ,
+        char const *_kind ,
+        hash_type  &_hash ,
+        containers::array<iptr_type> &_nmap ,
+        iptr_type   _nnod
+        )
+    {
+    /*----------------- cell block from rDT hash-set data */
+        _bins.head(std::string(_kind) +
+            "=" + std::to_string(_hash.count())) ;
+
+        for (auto _iter  = _hash._lptr.head() ;
+                  _iter != _hash._lptr.tend() ;
+                ++_iter  )
+        {
+            if ( *_iter == nullptr) continue ;
+
+            for (auto _item  = *_iter ;
+                _item != nullptr;
+                _item  = _item->_next )
+            {
+            for (auto _inod = +0 ;
+                      _inod < _nnod; ++_inod)
+            {
+                _bins.push((std::int32_t)
+                    _nmap[_item->_data._node[_inod]]) ;
+            }
+                _bins.push((std::int32_t)
+                    _item->_data._part) ;
+            }
+        }
+    }
+
     /*
     --------------------------------------------------------
      * SAVE-RDEL: save *.MSH output file.
@@ -116,7 +440,10 @@
             std::ofstream  _file;
             _file.open(
                 _jcfg._mesh_file,
-            std::ofstream::out | std::ofstream::trunc) ;
+            std::ofstream::out | std::ofstream::trunc |
+           (_jcfg._file_bins ?
+            std::ofstream::binary :
+            std::ofstream::out)) ;
 
             if (_file.is_open())
             {
@@ -128,6 +455,9 @@
                 _file << "# " << _name << ".msh"
                       << "; created by " ;
                 _file << __JGSWVSTR "\n" ;
+                if (_jcfg._file_bins)
+                _file << "MSHID=2;EUCLIDEAN-MESH;BINARY\n" ;
+                else
                 _file << "MSHID=2;EUCLIDEAN-MESH \n" ;
                 _file << "NDIMS=2 \n" ;
 
@@ -187,6 +517,17 @@
                     }
                 }
 
+                if (_rdel._euclidean_rdel_2d.
+                        _tria._nset.count() > 0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write POINT bins */
+                bins_write _bins(_file) ;
+                bins_point(_bins, _rdel.
+                    _euclidean_rdel_2d._tria._nset ,
+                    _nmap, _last, +2) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_2d.
                         _tria._nset.count() > 0)
                 {
@@ -218,6 +559,17 @@
 
                 if (_jcfg._iter_opts.dual() )
                 {
+                if (_rdel._euclidean_rdel_2d.
+                        _tria._nset.count() > 0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write POWER bins */
+                bins_write _bins(_file) ;
+                bins_power(_bins, _rdel.
+                    _euclidean_rdel_2d._tria._nset ,
+                    _nmap, _last, +2) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_2d.
                         _tria._nset.count() > 0)
                 {
@@ -247,6 +599,17 @@
                 }
                 }
 
+                if (_rdel._euclidean_rdel_2d.
+                        _eset.count() > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write EDGE2 bins */
+                bins_write _bins(_file) ;
+                bins_hash (_bins, "EDGE2", _rdel.
+                    _euclidean_rdel_2d._eset ,
+                    _nmap, +2) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_2d.
                         _eset.count() > +0)
                 {
@@ -280,6 +643,17 @@
                     PRINTFINAL;
                 }
 
+                if (_rdel._euclidean_rdel_2d.
+                        _tset.count() > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write TRIA3 bins */
+                bins_write _bins(_file) ;
+                bins_hash (_bins, "TRIA3", _rdel.
+                    _euclidean_rdel_2d._tset ,
+                    _nmap, +3) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_2d.
                         _tset.count() > +0)
                 {
@@ -324,6 +698,9 @@
                 _file << "# " << _name << ".msh"
                       << "; created by " ;
                 _file << __JGSWVSTR "\n" ;
+                if (_jcfg._file_bins)
+                _file << "MSHID=2;EUCLIDEAN-MESH;BINARY\n" ;
+                else
                 _file << "MSHID=2;EUCLIDEAN-MESH \n" ;
                 _file << "NDIMS=3 \n" ;
 
@@ -406,6 +783,17 @@
                     }
                 }
 
+                if (_rdel._euclidean_rdel_3d.
+                        _tria._nset.count() > 0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write POINT bins */
+                bins_write _bins(_file) ;
+                bins_point(_bins, _rdel.
+                    _euclidean_rdel_3d._tria._nset ,
+                    _nmap, _last, +3) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_3d.
                         _tria._nset.count() > 0)
                 {
@@ -438,6 +826,17 @@
 
                 if (_jcfg._iter_opts.dual() )
                 {
+                if (_rdel._euclidean_rdel_3d.
+                        _tria._nset.count() > 0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write POWER bins */
+                bins_write _bins(_file) ;
+                bins_power(_bins, _rdel.
+                    _euclidean_rdel_3d._tria._nset ,
+                    _nmap, _last, +3) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_3d.
                         _tria._nset.count() > 0)
                 {
@@ -467,6 +866,17 @@
                 }
                 }
 
+                if (_rdel._euclidean_rdel_3d.
+                        _eset.count() > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write EDGE2 bins */
+                bins_write _bins(_file) ;
+                bins_hash (_bins, "EDGE2", _rdel.
+                    _euclidean_rdel_3d._eset ,
+                    _nmap, +2) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_3d.
                         _eset.count() > +0)
                 {
@@ -500,6 +910,17 @@
                     PRINTFINAL;
                 }
 
+                if (_rdel._euclidean_rdel_3d.
+                        _fset.count() > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write TRIA3 bins */
+                bins_write _bins(_file) ;
+                bins_hash (_bins, "TRIA3", _rdel.
+                    _euclidean_rdel_3d._fset ,
+                    _nmap, +3) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_3d.
                         _fset.count() > +0)
                 {
@@ -534,6 +955,17 @@
                     PRINTFINAL;
                 }
 
+                if (_rdel._euclidean_rdel_3d.
+                        _tset.count() > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write TRIA4 bins */
+                bins_write _bins(_file) ;
+                bins_hash (_bins, "TRIA4", _rdel.
+                    _euclidean_rdel_3d._tset ,
+                    _nmap, +4) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_3d.
                         _tset.count() > +0)
                 {
@@ -1086,7 +1518,10 @@
             std::ofstream  _file;
             _file.open(
                 _jcfg._tria_file,
-            std::ofstream::out | std::ofstream::trunc) ;
+            std::ofstream::out | std::ofstream::trunc |
+           (_jcfg._file_bins ?
+            std::ofstream::binary :
+            std::ofstream::out)) ;
 
             if (_file.is_open())
             {
@@ -1098,6 +1533,9 @@
                 _file << "# " << _name << ".msh"
                       << "; created by " ;
                 _file << __JGSWVSTR "\n" ;
+                if (_jcfg._file_bins)
+                _file << "MSHID=2;EUCLIDEAN-MESH;BINARY\n" ;
+                else
                 _file << "MSHID=2;EUCLIDEAN-MESH \n" ;
                 _file << "NDIMS=2 \n" ;
 
@@ -1133,6 +1571,17 @@
                     }
                 }
 
+                if (_rdel._euclidean_rdel_2d.
+                        _tria._nset.count() > 0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write POINT bins */
+                bins_write _bins(_file) ;
+                bins_point(_bins, _rdel.
+                    _euclidean_rdel_2d._tria._nset ,
+                    _nmap, _last, +2) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_2d.
                         _tria._nset.count() > 0)
                 {
@@ -1162,6 +1611,17 @@
                     PRINTFINAL;
                 }
 
+                if (_rdel._euclidean_rdel_2d.
+                        _tria._tset.count() > 0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write TRIA3 bins */
+                bins_write _bins(_file) ;
+                bins_tria (_bins, "TRIA3", _rdel.
+                    _euclidean_rdel_2d._tria._tset ,
+                    _nmap, _ntri, +3) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_2d.
                         _tria._tset.count() > 0)
                 {
@@ -1198,6 +1658,9 @@
                 _file << "# " << _name << ".msh"
                       << "; created by " ;
                 _file << __JGSWVSTR "\n" ;
+                if (_jcfg._file_bins)
+                _file << "MSHID=2;EUCLIDEAN-MESH;BINARY\n" ;
+                else
                 _file << "MSHID=2;EUCLIDEAN-MESH \n" ;
                 _file << "NDIMS=3 \n" ;
 
@@ -1234,6 +1697,17 @@
                     }
                 }
 
+                if (_rdel._euclidean_rdel_3d.
+                        _tria._nset.count() > 0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write POINT bins */
+                bins_write _bins(_file) ;
+                bins_point(_bins, _rdel.
+                    _euclidean_rdel_3d._tria._nset ,
+                    _nmap, _last, +3) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_3d.
                         _tria._nset.count() > 0)
                 {
@@ -1264,6 +1738,17 @@
                     PRINTFINAL;
                 }
 
+                if (_rdel._euclidean_rdel_3d.
+                        _tria._tset.count() > 0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write TRIA3 bins */
+                bins_write _bins(_file) ;
+                bins_tria (_bins, "TRIA4", _rdel.
+                    _euclidean_rdel_3d._tria._tset ,
+                    _nmap, _ntri, +4) ;
+                }
+                else
                 if (_rdel._euclidean_rdel_3d.
                         _tria._tset.count() > 0)
                 {
@@ -1593,12 +2078,54 @@
         return ( _errv ) ;
     }
 
+    /*
+    --------------------------------------------------------
+     * DUMP-BYTES: log mesh memory footprint + RSS.
+    --------------------------------------------------------
+     */
+
+    // MESH_RSS is sampled with only the MESH-COMPLEX held,
+    // COMP_RSS with only the snapshot, after the complex
+    // is released. PEAK-RSS is the whole-run high-water
+    // mark, and is usually set during meshing.
+
+    __normal_call std::string dump_bytes (
+        std::size_t _mesh_bytes ,
+        std::size_t _comp_bytes ,
+        std::size_t _mesh_rss ,
+        std::size_t _comp_rss
+        )
+    {
+        std::stringstream _sstr;
+        _sstr << std::fixed
+              << std::setprecision(2)
+              << "  |MESH-COMPLEX| = "
+              << _mesh_bytes / 1048576. << " MB\n"
+              << "  |MESH-COMPACT| = "
+              << _comp_bytes / 1048576. << " MB\n"
+              << "  |RSS-COMPLEX|  = "
+              << _mesh_rss / 1048576. << " MB\n"
+              << "  |RSS-COMPACT|  = "
+              << _comp_rss / 1048576. << " MB\n"
+              << "  |PEAK-RSS|     = "
+              << peak_rss () / 1048576. << " MB\n"
+              << "\n" ;
+
+        return _sstr.str () ;
+    }
+
     /*
     --------------------------------------------------------
      * SAVE-MESH: save *.MSH output file.
     --------------------------------------------------------
      */
 
+    // Active nodes + cells are first copied into a compact
+    // SoA snapshot in bulk, the MESH-COMPLEX is released,
+    // and the file is written from the snapshot alone. At
+    // VERBOSITY > 0 the footprint of both layouts, and the
+    // RSS held with each, are echoed to the log.
+
     template <
     typename      jlog_data
              >
@@ -1610,12 +2137,16 @@
     {
         iptr_type _errv  = __no_error  ;
 
-        __unreferenced(_jlog) ;
+        typedef mesh::mesh_compact_k <
+                real_type ,
+                iptr_type , +2 >    compact_2d ;
+
+        typedef mesh::mesh_compact_k <
+                real_type ,
+                iptr_type , +3 >    compact_3d ;
 
         try
         {
-            containers::array<iptr_type> _nmap;
-
             std::string _path, _name, _fext;
             file_part(
                 _jcfg._mesh_file, _path, _name, _fext) ;
@@ -1623,7 +2154,10 @@
             std::ofstream  _file;
             _file.open(
                 _jcfg._mesh_file,
-            std::ofstream::out | std::ofstream::trunc) ;
+            std::ofstream::out | std::ofstream::trunc |
+           (_jcfg._file_bins ?
+            std::ofstream::binary :
+            std::ofstream::out)) ;
 
             if (_file.is_open())
             {
@@ -1635,135 +2169,106 @@
                 _file << "# " << _name << ".msh"
                       << "; created by " ;
                 _file << __JGSWVSTR "\n" ;
+                if (_jcfg._file_bins)
+                _file << "MSHID=3;EUCLIDEAN-MESH;BINARY\n" ;
+                else
                 _file << "MSHID=3;EUCLIDEAN-MESH \n" ;
                 _file << "NDIMS=2 \n" ;
 
-            /*------------ index mapping for active nodes */
-                _nmap.set_count(_mesh.
-                _euclidean_mesh_2d._mesh.node().count() ,
-                    containers::tight_alloc, -1) ;
+            /*------------ compact copy of active cells */
+                std::size_t _mrss = curr_rss() ;
+                std::size_t _size = mesh::mesh_bytes(
+                    _mesh._euclidean_mesh_2d._mesh) ;
 
-                iptr_type _nnN1 = +0 ;
-                iptr_type _nnE2 = +0 ;
-                iptr_type _nnT3 = +0 ;
-                iptr_type _nnQ4 = +0 ;
+                compact_2d _comp ;
+                mesh::make_compact(
+                    _mesh._euclidean_mesh_2d._mesh, _comp) ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_2d._mesh.edge().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_2d._mesh.edge().tend() ;
-                        ++_iter  )
-                {
-                    if (_iter->mark() >= +0 &&
-                        _iter->self() >= +1 )
-                    {
-                    _nmap[_iter->node(0)] = +1 ;
-                    _nmap[_iter->node(1)] = +1 ;
-                    _nnE2 +=  +1 ;
-                    }
-                }
+                _mesh._euclidean_mesh_2d.
+                    _mesh.clear(containers::tight_alloc) ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_2d._mesh.tri3().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_2d._mesh.tri3().tend() ;
-                        ++_iter  )
+                if (_jcfg._verbosity > +0)
                 {
-                    if (_iter->mark() >= +0 &&
-                        _iter->self() >= +1 )
-                    {
-                    _nmap[_iter->node(0)] = +1 ;
-                    _nmap[_iter->node(1)] = +1 ;
-                    _nmap[_iter->node(2)] = +1 ;
-                    _nnT3 +=  +1 ;
-                    }
+                _jlog.push(dump_bytes(
+                    _size, _comp.bytes() ,
+                    _mrss, curr_rss())) ;
                 }
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_2d._mesh.quad().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_2d._mesh.quad().tend() ;
-                        ++_iter  )
-                {
-                    if (_iter->mark() >= +0 &&
-                        _iter->self() >= +1 )
-                    {
-                    _nmap[_iter->node(0)] = +1 ;
-                    _nmap[_iter->node(1)] = +1 ;
-                    _nmap[_iter->node(2)] = +1 ;
-                    _nmap[_iter->node(3)] = +1 ;
-                    _nnQ4 +=  +1 ;
-                    }
-                }
+                iptr_type _nnE2 = _comp.
+                    _cnum[compact_2d::edge_kind] ;
+                iptr_type _nnT3 = _comp.
+                    _cnum[compact_2d::tri3_kind] ;
+                iptr_type _nnQ4 = _comp.
+                    _cnum[compact_2d::quad_kind] ;
 
-                for (auto _iter  = _nmap.head();
-                          _iter != _nmap.tend();
-                        ++_iter  )
+                if (_comp._nnum > +0 &&
+                    _jcfg._file_bins)
                 {
-                    if ( *_iter >= +0)
-                    {
-                         *_iter = _nnN1 ++ ;
-                    }
+            /*-------------------------- write POINT bins */
+                bins_write _bins(_file) ;
+                bins_point(_bins, _comp, +2) ;
                 }
-
-                if (_nnN1 > +0)
+                else
+                if (_comp._nnum > +0)
                 {
             /*-------------------------- write POINT data */
-                _file << "POINT=" << _nnN1 << "\n" ;
+                _file << "POINT=" << _comp._nnum << "\n" ;
 
-                 auto _next = +0, _roll = +0,
-                      _npos = +0;
+                 auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_2d._mesh.node().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_2d._mesh.node().tend() ;
-                        ++_iter, ++_npos)
+                for (auto _npos = +0 ;
+                          _npos < _comp._nnum; ++_npos)
                 {
-                    if (_iter->mark() >= 0 &&
-                        _nmap[_npos ] >= 0 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK,
                         "%.17g;%.17g;+0\n" ,
-                        _iter->pval(0) ,
-                        _iter->pval(1) ), VERT2CHUNK)
-                    }
+                        _comp._pval[0][_npos] ,
+                        _comp._pval[1][_npos] ), VERT2CHUNK)
                 }
                     PRINTFINAL;
                 }
 
-                if (_nnN1 > +0)
+                if (_comp._nnum > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write POWER bins */
+                bins_write _bins(_file) ;
+                if (_jcfg._iter_opts.dual() )
+                bins_power(_bins, _comp, +2) ;
+                }
+                else
+                if (_comp._nnum > +0)
                 {
             /*-------------------------- write POWER data */
                 if (_jcfg._iter_opts.dual() )
                 {
                 _file << "POWER="
-                      << _nnN1 << ";1" << "\n" ;
+                      << _comp._nnum << ";1" << "\n" ;
 
-                 auto _next = +0, _roll = +0,
-                      _npos = +0;
+                 auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_2d._mesh.node().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_2d._mesh.node().tend() ;
-                        ++_iter, ++_npos)
+                for (auto _npos = +0 ;
+                          _npos < _comp._nnum; ++_npos)
                 {
-                    if (_iter->mark() >= 0 &&
-                        _nmap[_npos ] >= 0)
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK, "%.17g\n" ,
-                        _iter->pval(2) ), VALUECHUNK)
-                    }
+                        _comp._pval[2][_npos] ), VALUECHUNK)
                 }
                     PRINTFINAL;
                 }
                 }
 
+                if (_nnE2 > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write EDGE2 bins */
+                bins_write _bins(_file) ;
+                bins_cells(_bins, "EDGE2", _comp,
+                    compact_2d::edge_kind) ;
+                }
+                else
                 if (_nnE2 > +0)
                 {
             /*-------------------------- write EDGE2 data */
@@ -1772,25 +2277,33 @@
                  auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_2d._mesh.edge().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_2d._mesh.edge().tend() ;
-                        ++_iter  )
+                 iptr_type const*_cnod =
+                _comp._cnod[compact_2d::edge_kind] ;
+                 iptr_type const*_ctag =
+                _comp._ctag[compact_2d::edge_kind] ;
+
+                for (auto _cpos = +0 ;
+                          _cpos < _nnE2;
+                        ++_cpos  )
                 {
-                    if (_iter->mark() >= 0 &&
-                        _iter->self() >= 1 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK, "%u;%u;%d\n",
-                    _nmap[_iter->node(0)] ,
-                    _nmap[_iter->node(1)] ,
-                          _iter->itag()), EDGE2CHUNK)
-                    }
+                    _cnod[_cpos * 2 + 0] ,
+                    _cnod[_cpos * 2 + 1] ,
+                    _ctag[_cpos] ), EDGE2CHUNK)
                 }
                     PRINTFINAL;
                 }
 
+                if (_nnT3 > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write TRIA3 bins */
+                bins_write _bins(_file) ;
+                bins_cells(_bins, "TRIA3", _comp,
+                    compact_2d::tri3_kind) ;
+                }
+                else
                 if (_nnT3 > +0)
                 {
             /*-------------------------- write TRIA3 data */
@@ -1799,26 +2312,34 @@
                  auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_2d._mesh.tri3().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_2d._mesh.tri3().tend() ;
-                        ++_iter  )
+                 iptr_type const*_cnod =
+                _comp._cnod[compact_2d::tri3_kind] ;
+                 iptr_type const*_ctag =
+                _comp._ctag[compact_2d::tri3_kind] ;
+
+                for (auto _cpos = +0 ;
+                          _cpos < _nnT3;
+                        ++_cpos  )
                 {
-                    if (_iter->mark() >= 0 &&
-                        _iter->self() >= 1 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK, "%u;%u;%u;%d\n",
-                    _nmap[_iter->node(0)] ,
-                    _nmap[_iter->node(1)] ,
-                    _nmap[_iter->node(2)] ,
-                          _iter->itag()), TRIA3CHUNK)
-                    }
+                    _cnod[_cpos * 3 + 0] ,
+                    _cnod[_cpos * 3 + 1] ,
+                    _cnod[_cpos * 3 + 2] ,
+                    _ctag[_cpos] ), TRIA3CHUNK)
                 }
                     PRINTFINAL;
                 }
 
+                if (_nnQ4 > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write QUAD4 bins */
+                bins_write _bins(_file) ;
+                bins_cells(_bins, "QUAD4", _comp,
+                    compact_2d::quad_kind) ;
+                }
+                else
                 if (_nnQ4 > +0)
                 {
             /*-------------------------- write QUAD4 data */
@@ -1827,24 +2348,23 @@
                  auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_2d._mesh.quad().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_2d._mesh.quad().tend() ;
-                        ++_iter  )
+                 iptr_type const*_cnod =
+                _comp._cnod[compact_2d::quad_kind] ;
+                 iptr_type const*_ctag =
+                _comp._ctag[compact_2d::quad_kind] ;
+
+                for (auto _cpos = +0 ;
+                          _cpos < _nnQ4;
+                        ++_cpos  )
                 {
-                    if (_iter->mark() >= 0 &&
-                        _iter->self() >= 1 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK,
                         "%u;%u;%u;%u;%d\n",
-                    _nmap[_iter->node(0)] ,
-                    _nmap[_iter->node(1)] ,
-                    _nmap[_iter->node(2)] ,
-                    _nmap[_iter->node(3)] ,
-                          _iter->itag()), QUAD4CHUNK)
-                    }
+                    _cnod[_cpos * 4 + 0] ,
+                    _cnod[_cpos * 4 + 1] ,
+                    _cnod[_cpos * 4 + 2] ,
+                    _cnod[_cpos * 4 + 3] ,
+                    _ctag[_cpos] ), QUAD4CHUNK)
                 }
                     PRINTFINAL;
                 }
@@ -1859,154 +2379,109 @@
                 _file << "# " << _name << ".msh"
                       << "; created by " ;
                 _file << __JGSWVSTR "\n" ;
+                if (_jcfg._file_bins)
+                _file << "MSHID=3;EUCLIDEAN-MESH;BINARY\n" ;
+                else
                 _file << "MSHID=3;EUCLIDEAN-MESH \n" ;
                 _file << "NDIMS=3 \n" ;
 
-            /*------------ index mapping for active nodes */
-                _nmap.set_count(_mesh.
-                _euclidean_mesh_3d._mesh.node().count() ,
-                    containers::tight_alloc, -1) ;
+            /*------------ compact copy of active cells */
+                std::size_t _mrss = curr_rss() ;
+                std::size_t _size = mesh::mesh_bytes(
+                    _mesh._euclidean_mesh_3d._mesh) ;
 
-                iptr_type _nnN1 = +0 ;
-                iptr_type _nnE2 = +0 ;
-                iptr_type _nnT3 = +0 ;
-                iptr_type _nnQ4 = +0 ;
-                iptr_type _nnT4 = +0 ;
+                compact_3d _comp ;
+                mesh::make_compact(
+                    _mesh._euclidean_mesh_3d._mesh, _comp) ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.edge().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.edge().tend() ;
-                        ++_iter  )
-                {
-                    if (_iter->mark() >= +0 &&
-                        _iter->self() >= +1 )
-                    {
-                    _nmap[_iter->node(0)] = +1 ;
-                    _nmap[_iter->node(1)] = +1 ;
-                    _nnE2 +=  +1 ;
-                    }
-                }
-
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.tri3().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.tri3().tend() ;
-                        ++_iter  )
-                {
-                    if (_iter->mark() >= +0 &&
-                        _iter->self() >= +1 )
-                    {
-                    _nmap[_iter->node(0)] = +1 ;
-                    _nmap[_iter->node(1)] = +1 ;
-                    _nmap[_iter->node(2)] = +1 ;
-                    _nnT3 +=  +1 ;
-                    }
-                }
+                _mesh._euclidean_mesh_3d.
+                    _mesh.clear(containers::tight_alloc) ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.quad().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.quad().tend() ;
-                        ++_iter  )
+                if (_jcfg._verbosity > +0)
                 {
-                    if (_iter->mark() >= +0 &&
-                        _iter->self() >= +1 )
-                    {
-                    _nmap[_iter->node(0)] = +1 ;
-                    _nmap[_iter->node(1)] = +1 ;
-                    _nmap[_iter->node(2)] = +1 ;
-                    _nmap[_iter->node(3)] = +1 ;
-                    _nnQ4 +=  +1 ;
-                    }
+                _jlog.push(dump_bytes(
+                    _size, _comp.bytes() ,
+                    _mrss, curr_rss())) ;
                 }
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.tri4().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.tri4().tend() ;
-                        ++_iter  )
-                {
-                    if (_iter->mark() >= +0 &&
-                        _iter->self() >= +1 )
-                    {
-                    _nmap[_iter->node(0)] = +1 ;
-                    _nmap[_iter->node(1)] = +1 ;
-                    _nmap[_iter->node(2)] = +1 ;
-                    _nmap[_iter->node(3)] = +1 ;
-                    _nnT4 +=  +1 ;
-                    }
-                }
+                iptr_type _nnE2 = _comp.
+                    _cnum[compact_3d::edge_kind] ;
+                iptr_type _nnT3 = _comp.
+                    _cnum[compact_3d::tri3_kind] ;
+                iptr_type _nnQ4 = _comp.
+                    _cnum[compact_3d::quad_kind] ;
+                iptr_type _nnT4 = _comp.
+                    _cnum[compact_3d::tri4_kind] ;
 
-                for (auto _iter  = _nmap.head();
-                          _iter != _nmap.tend();
-                        ++_iter  )
+                if (_comp._nnum > +0 &&
+                    _jcfg._file_bins)
                 {
-                    if ( *_iter >= +0)
-                    {
-                         *_iter = _nnN1 ++ ;
-                    }
+            /*-------------------------- write POINT bins */
+                bins_write _bins(_file) ;
+                bins_point(_bins, _comp, +3) ;
                 }
-
-                if (_nnN1 > +0)
+                else
+                if (_comp._nnum > +0)
                 {
             /*-------------------------- write POINT data */
-                _file << "POINT=" << _nnN1 << "\n" ;
+                _file << "POINT=" << _comp._nnum << "\n" ;
 
-                 auto _next = +0, _roll = +0,
-                      _npos = +0;
+                 auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.node().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.node().tend() ;
-                        ++_iter, ++_npos)
+                for (auto _npos = +0 ;
+                          _npos < _comp._nnum; ++_npos)
                 {
-                    if (_iter->mark() >= 0 &&
-                        _nmap[_npos ] >= 0 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK,
                         "%.17g;%.17g;%.17g;+0\n" ,
-                        _iter->pval(0) ,
-                        _iter->pval(1) ,
-                        _iter->pval(2) ), VERT3CHUNK)
-                    }
+                        _comp._pval[0][_npos] ,
+                        _comp._pval[1][_npos] ,
+                        _comp._pval[2][_npos] ), VERT3CHUNK)
                 }
                     PRINTFINAL;
                 }
 
-                if (_nnN1 > +0)
+                if (_comp._nnum > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write POWER bins */
+                bins_write _bins(_file) ;
+                if (_jcfg._iter_opts.dual() )
+                bins_power(_bins, _comp, +3) ;
+                }
+                else
+                if (_comp._nnum > +0)
                 {
             /*-------------------------- write POWER data */
                 if (_jcfg._iter_opts.dual() )
                 {
                 _file << "POWER="
-                      << _nnN1 << ";1" << "\n" ;
+                      << _comp._nnum << ";1" << "\n" ;
 
-                 auto _next = +0, _roll = +0,
-                      _npos = +0;
+                 auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.node().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.node().tend() ;
-                        ++_iter, ++_npos)
+                for (auto _npos = +0 ;
+                          _npos < _comp._nnum; ++_npos)
                 {
-                    if (_iter->mark() >= 0 &&
-                        _nmap[_npos ] >= 0)
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK, "%.17g\n" ,
-                        _iter->pval(3) ), VALUECHUNK)
-                    }
+                        _comp._pval[3][_npos] ), VALUECHUNK)
                 }
                     PRINTFINAL;
                 }
                 }
 
+                if (_nnE2 > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write EDGE2 bins */
+                bins_write _bins(_file) ;
+                bins_cells(_bins, "EDGE2", _comp,
+                    compact_3d::edge_kind) ;
+                }
+                else
                 if (_nnE2 > +0)
                 {
             /*-------------------------- write EDGE2 data */
@@ -2015,25 +2490,33 @@
                  auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.edge().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.edge().tend() ;
-                        ++_iter  )
+                 iptr_type const*_cnod =
+                _comp._cnod[compact_3d::edge_kind] ;
+                 iptr_type const*_ctag =
+                _comp._ctag[compact_3d::edge_kind] ;
+
+                for (auto _cpos = +0 ;
+                          _cpos < _nnE2;
+                        ++_cpos  )
                 {
-                    if (_iter->mark() >= 0 &&
-                        _iter->self() >= 1 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK, "%u;%u;%d\n",
-                    _nmap[_iter->node(0)] ,
-                    _nmap[_iter->node(1)] ,
-                          _iter->itag()), EDGE2CHUNK)
-                    }
+                    _cnod[_cpos * 2 + 0] ,
+                    _cnod[_cpos * 2 + 1] ,
+                    _ctag[_cpos] ), EDGE2CHUNK)
                 }
                     PRINTFINAL;
                 }
 
+                if (_nnT3 > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write TRIA3 bins */
+                bins_write _bins(_file) ;
+                bins_cells(_bins, "TRIA3", _comp,
+                    compact_3d::tri3_kind) ;
+                }
+                else
                 if (_nnT3 > +0)
                 {
             /*-------------------------- write TRIA3 data */
@@ -2042,26 +2525,34 @@
                  auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.tri3().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.tri3().tend() ;
-                        ++_iter  )
+                 iptr_type const*_cnod =
+                _comp._cnod[compact_3d::tri3_kind] ;
+                 iptr_type const*_ctag =
+                _comp._ctag[compact_3d::tri3_kind] ;
+
+                for (auto _cpos = +0 ;
+                          _cpos < _nnT3;
+                        ++_cpos  )
                 {
-                    if (_iter->mark() >= 0 &&
-                        _iter->self() >= 1 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK, "%u;%u;%u;%d\n",
-                    _nmap[_iter->node(0)] ,
-                    _nmap[_iter->node(1)] ,
-                    _nmap[_iter->node(2)] ,
-                          _iter->itag()), TRIA3CHUNK)
-                    }
+                    _cnod[_cpos * 3 + 0] ,
+                    _cnod[_cpos * 3 + 1] ,
+                    _cnod[_cpos * 3 + 2] ,
+                    _ctag[_cpos] ), TRIA3CHUNK)
                 }
                     PRINTFINAL;
                 }
 
+                if (_nnQ4 > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write QUAD4 bins */
+                bins_write _bins(_file) ;
+                bins_cells(_bins, "QUAD4", _comp,
+                    compact_3d::quad_kind) ;
+                }
+                else
                 if (_nnQ4 > +0)
                 {
             /*-------------------------- write QUAD4 data */
@@ -2070,28 +2561,36 @@
                  auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.quad().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.quad().tend() ;
-                        ++_iter  )
+                 iptr_type const*_cnod =
+                _comp._cnod[compact_3d::quad_kind] ;
+                 iptr_type const*_ctag =
+                _comp._ctag[compact_3d::quad_kind] ;
+
+                for (auto _cpos = +0 ;
+                          _cpos < _nnQ4;
+                        ++_cpos  )
                 {
-                    if (_iter->mark() >= 0 &&
-                        _iter->self() >= 1 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK,
                         "%u;%u;%u;%u;%d\n",
-                    _nmap[_iter->node(0)] ,
-                    _nmap[_iter->node(1)] ,
-                    _nmap[_iter->node(2)] ,
-                    _nmap[_iter->node(3)] ,
-                          _iter->itag()), QUAD4CHUNK)
-                    }
+                    _cnod[_cpos * 4 + 0] ,
+                    _cnod[_cpos * 4 + 1] ,
+                    _cnod[_cpos * 4 + 2] ,
+                    _cnod[_cpos * 4 + 3] ,
+                    _ctag[_cpos] ), QUAD4CHUNK)
                 }
                     PRINTFINAL;
                 }
 
+                if (_nnT4 > +0 &&
+                    _jcfg._file_bins)
+                {
+            /*-------------------------- write TRIA4 bins */
+                bins_write _bins(_file) ;
+                bins_cells(_bins, "TRIA4", _comp,
+                    compact_3d::tri4_kind) ;
+                }
+                else
                 if (_nnT4 > +0)
                 {
             /*-------------------------- write TRIA4 data */
@@ -2100,24 +2599,23 @@
                  auto _next = +0, _roll = +0;
                  char _fbuf[PRINTCHUNK] ;
 
-                for (auto _iter  = _mesh.
-                _euclidean_mesh_3d._mesh.tri4().head() ;
-                          _iter != _mesh.
-                _euclidean_mesh_3d._mesh.tri4().tend() ;
-                        ++_iter  )
+                 iptr_type const*_cnod =
+                _comp._cnod[compact_3d::tri4_kind] ;
+                 iptr_type const*_ctag =
+                _comp._ctag[compact_3d::tri4_kind] ;
+
+                for (auto _cpos = +0 ;
+                          _cpos < _nnT4;
+                        ++_cpos  )
                 {
-                    if (_iter->mark() >= 0 &&
-                        _iter->self() >= 1 )
-                    {
                     PRINTCHARS(snprintf(&_fbuf[_next] ,
                         PRINTCHUNK,
                         "%u;%u;%u;%u;%d\n",
-                    _nmap[_iter->node(0)] ,
-                    _nmap[_iter->node(1)] ,
-                    _nmap[_iter->node(2)] ,
-                    _nmap[_iter->node(3)] ,
-                          _iter->itag()), TRIA4CHUNK)
-                    }
+                    _cnod[_cpos * 4 + 0] ,
+                    _cnod[_cpos * 4 + 1] ,
+                    _cnod[_cpos * 4 + 2] ,
+                    _cnod[_cpos * 4 + 3] ,
+                    _ctag[_cpos] ), TRIA4CHUNK)
                 }
                     PRINTFINAL;
                 }
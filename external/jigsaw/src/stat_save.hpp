@@ -0,0 +1,239 @@
+    /*
+    --------------------------------------------------------
+     * STAT-SAVE: push perf-stat data into *.JSON file.
+    --------------------------------------------------------
+     *
+     * This program may be freely redistributed under the
+     * condition that the copyright notices (including this
+     * entire header) are not removed, and no compensation
+     * is received through use of the software.  Private,
+     * research, and institutional use is free.  You may
+     * distribute modified versions of this code UNDER THE
+     * CONDITION THAT THIS CODE AND ANY MODIFICATIONS MADE
+     * TO IT IN THE SAME FILE REMAIN UNDER COPYRIGHT OF THE
+     * ORIGINAL AUTHOR, BOTH SOURCE AND OBJECT CODE ARE
+     * MADE FREELY AVAILABLE WITHOUT CHARGE, AND CLEAR
+     * NOTICE IS GIVEN OF THE MODIFICATIONS.  Distribution
+     * of this code as part of a commercial system is
+     * permissible ONLY BY DIRECT ARRANGEMENT WITH THE
+     * AUTHOR.  (If you are not directly supplying this
+     * code to a customer, and you are instead telling them
+     * how they can obtain it for free, then you are not
+     * required to make any arrangement with me.)
+     *
+     * Disclaimer:  Neither I nor: Columbia University, The
+     * Massachusetts Institute of Technology, The
+     * University of Sydney, nor The National Aeronautics
+     * and Space Administration warrant this code in any
+     * way whatsoever.  This code is provided "as-is" to be
+     * used at your own risk.
+     *
+    --------------------------------------------------------
+     *
+     * Last updated: 18 October, 2026
+     *
+     * Copyright 2013-2020
+     * Darren Engwirda
+     * d.engwirda@gmail.com
+     * https://github.com/dengwirda/
+     *
+    --------------------------------------------------------
+     */
+
+#   pragma once
+
+#   ifndef __STAT_SAVE__
+#   define __STAT_SAVE__
+
+    /*
+    --------------------------------------------------------
+     * RESET-STAT: zero perf-stat data before a run.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type reset_stat (
+        )
+    {
+        perfstat::reset() ;
+        geompred::zero_calls() ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * OPEN-STAT: start counts if a STAT_FILE is set.
+    --------------------------------------------------------
+     */
+
+    __normal_call void_type open_stat (
+        jcfg_data &_jcfg
+        )
+    {
+        if(!_jcfg._stat_file.empty())
+            perfstat::start() ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * SAVE-STAT: push perf-stat data into file.
+    --------------------------------------------------------
+     */
+
+    // Counters are summed over all threads: || regions
+    // fold their own counts on exit, the calling thread
+    // is folded here. Stage + iter. timings are only
+    // collected if __use_timers is defined.
+
+    template <
+    typename      jlog_data
+             >
+    __normal_call iptr_type save_stat (
+        jcfg_data &_jcfg ,
+        jlog_data &_jlog ,
+        char const*_tool
+        )
+    {
+        iptr_type _errv  = __no_error  ;
+
+        __unreferenced(_jlog) ;
+
+        perfstat::fold() ;
+        geompred::fold_calls() ;
+
+        try
+        {
+            std::ofstream  _file;
+            _file.open(
+                _jcfg._stat_file,
+            std::ofstream::out | std::ofstream::trunc) ;
+
+            if (_file.is_open())
+            {
+            /*-------------------------- save tool + vers */
+                double _ttot = +0. ;
+                for (auto _ipos = +0 ; _ipos <
+                        (int)perfstat::_nn_time; ++_ipos)
+                {
+                    _ttot += perfstat::_tt_time[_ipos] ;
+                }
+
+                _file << std::fixed
+                      << std::setprecision(6) ;
+
+                _file << "{\n" ;
+                _file << "  \"tool\": \""
+                      << _tool << "\",\n" ;
+                _file << "  \"version\": \""
+                      << __JGSWVSTR << "\",\n" ;
+                _file << "  \"total-time\": "
+                      << _ttot << ",\n" ;
+
+            /*-------------------------- save stage times */
+                _file << "  \"stages\": [" ;
+                for (auto _ipos = +0 ; _ipos <
+                        (int)perfstat::_nn_time; ++_ipos)
+                {
+                    _file << (_ipos > +0 ? "," : "")
+                          << "\n    {\"name\": \""
+                          << perfstat::_tt_name[_ipos]
+                          << "\", \"time\": "
+                          << perfstat::_tt_time[_ipos]
+                          << "}" ;
+                }
+                _file << "\n  ],\n" ;
+
+            /*-------------------------- save optim. iter */
+                std::size_t _nitr = std::min (
+                    perfstat::_nn_iter,
+                    perfstat::ITER_SLOTS) ;
+
+                _file << "  \"iterations\": [" ;
+                for (auto _ipos = +0 ; _ipos <
+                        (int)_nitr; ++_ipos)
+                {
+                    perfstat::iter_data const&_stat =
+                        perfstat::_tt_iter[_ipos] ;
+
+                    _file << (_ipos > +0 ? "," : "")
+                          << "\n    {\"time\": "
+                          << _stat._time
+                          << ", \"move\": "
+                          << _stat._nmov
+                          << ", \"flip\": "
+                          << _stat._nflp
+                          << ", \"merge\": "
+                          << _stat._nzip
+                          << ", \"split\": "
+                          << _stat._ndiv << "}" ;
+                }
+                _file << "\n  ],\n" ;
+
+            /*-------------------------- save hot counters */
+                std::size_t const*_ctot =
+                    perfstat::_tt_count ;
+
+                _file << "  \"counters\": {\n" ;
+                _file << "    \"hfun-eval\": "
+                      << _ctot[perfstat::HFUN_EVAL ]
+                      << ",\n" ;
+                _file << "    \"cavity-num\": "
+                      << _ctot[perfstat::CAVITY_NUM]
+                      << ",\n" ;
+                _file << "    \"cavity-sum\": "
+                      << _ctot[perfstat::CAVITY_SUM]
+                      << ",\n" ;
+                _file << "    \"cavity-max\": "
+                      << _ctot[perfstat::CAVITY_MAX]
+                      << ",\n" ;
+                _file << "    \"queue-push\": "
+                      << _ctot[perfstat::QUEUE_PUSH]
+                      << ",\n" ;
+                _file << "    \"queue-pops\": "
+                      << _ctot[perfstat::QUEUE_POPS]
+                      << "\n  },\n" ;
+
+            /*-------------------------- save pred. calls */
+                _file << "  \"predicates\": {" ;
+                for (auto _kern = +0 ; _kern <
+                        geompred::LASTKERNEL; ++_kern)
+                {
+                    _file << (_kern > +0 ? "," : "")
+                          << "\n    \""
+                          << geompred::_nm_calls[_kern]
+                          << "\": "
+                          << geompred::_tt_calls[_kern] ;
+                }
+                _file << "\n  },\n" ;
+
+            /*-------------------------- save alloc. size */
+                _file << "  \"memory\": {\n" ;
+                _file << "    \"alloc-peak\": "
+                      << perfstat::_pk_bytes.load()
+                      << ",\n" ;
+                _file << "    \"alloc-live\": "
+                      << perfstat::_nn_bytes.load()
+                      << ",\n" ;
+                _file << "    \"peak-rss\": "
+                      << peak_rss() << "\n  }\n" ;
+
+                _file << "}\n" ;
+            }
+            else
+            {
+                _errv = __file_not_created ;
+            }
+
+            _file.close();
+
+        }
+        catch (...)
+        {
+            _errv = __unknown_error ;
+        }
+
+        return ( _errv ) ;
+    }
+
+#   endif   //__STAT_SAVE__
+
+
+
@@ -272,6 +272,9 @@
     /*--------------------------------- init. geo. kernel */
         mp_float::exactinit() ;
 
+    /*--------------------------------- init. perf. stats */
+        reset_stat() ;
+
     /*--------------------------------- init. output data */
         jigsaw_init_msh_t(_mmsh) ;
 
@@ -319,6 +322,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-cfg-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -350,6 +355,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-init-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -382,6 +389,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-init-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -413,6 +422,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-geom-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -447,6 +458,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-geom-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -473,6 +486,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("generate-rdt-mesh",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -513,6 +528,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("writing-mesh-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -549,6 +566,9 @@
     /*--------------------------------- init. geo. kernel */
         mp_float::exactinit() ;
 
+    /*--------------------------------- init. perf. stats */
+        reset_stat() ;
+
     /*-------------------------- find *.JFCG file in args */
         iptr_type _retv = -1  ;
         jcfg_data _jcfg ;
@@ -640,9 +660,14 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-cfg-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
+    /*--------------------------------- init. perf. stats */
+        open_stat(_jcfg) ;
+
         if(!_jcfg._init_file.empty())
         {
     /*--------------------------------- parse *.INIT file */
@@ -671,6 +696,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-init-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -703,6 +730,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-init-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -734,6 +763,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("reading-geom-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -768,6 +799,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("forming-geom-data",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -794,6 +827,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("generate-rdt-mesh",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -818,6 +853,8 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("writing-tria-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
@@ -859,9 +896,22 @@
 #           ifdef  __use_timers
             _ttoc   = _time.now();
             _jlog.push(dump_time(_ttic, _ttoc));
+            perfstat::push_time("writing-mesh-file",
+                time_span(_ttic, _ttoc)) ;
 #           endif//__use_timers
         }
 
+        if(!_jcfg._stat_file.empty())
+        {
+    /*--------------------------------- dump stat to file */
+            if ((_retv = save_stat (
+                 _jcfg,
+                 _jlog, "tripod")) != __no_error)
+            {
+                return  _retv ;
+            }
+        }
+
     /*-------------------------- success, if we got here! */
 
         return ( _retv ) ;
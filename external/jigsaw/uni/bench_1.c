@@ -0,0 +1,236 @@
+
+//  gcc -Wall -O2 bench_1.c
+//  -Xlinker -rpath=../lib
+//  -L ../lib -ljigsaw -lm -o bench_1
+
+//  Compare MARCHE's HFUN_CLIP = MARCHING and SWEEPING sol-
+//  vers on large structured grids, in R^2 and on S^2.
+//
+//  bench_1 [XNUM] [YNUM] [CPUS]
+
+#   include "../inc/lib_jigsaw.h"
+
+#   include "stdio.h"
+#   include "stdlib.h"
+#   include "string.h"
+#   include "math.h"
+#   include "time.h"
+
+    double wall_time (
+        )
+    {
+        struct timespec _time ;
+        timespec_get(&_time, TIME_UTC) ;
+
+        return (double)_time.tv_sec +
+               (double)_time.tv_nsec * 1.E-09 ;
+    }
+
+    double rand_real (
+        unsigned long *_seed
+        )
+    {
+    /*-------------------------------- portable LCG in [0,1) */
+       *_seed = (*_seed * 1103515245UL +
+                     12345UL) % 2147483648UL ;
+
+        return (double)*_seed / 2147483648.0 ;
+    }
+
+    int bench_grid (
+        indx_t  _kind ,
+        indx_t  _xnum ,
+        indx_t  _ynum ,
+        indx_t  _cpus
+        )
+    {
+        int _retv = 0;
+
+        indx_t _ipos, _jpos, _nnum =
+            _xnum * _ynum ;
+
+        real_t *_xgrid = (real_t *)
+            malloc(_xnum * sizeof(real_t)) ;
+        real_t *_ygrid = (real_t *)
+            malloc(_ynum * sizeof(real_t)) ;
+
+        real_t *_hinit = (real_t *)
+            malloc(_nnum * sizeof(real_t)) ;
+        real_t *_hmarch = (real_t *)
+            malloc(_nnum * sizeof(real_t)) ;
+        real_t *_hsweep = (real_t *)
+            malloc(_nnum * sizeof(real_t)) ;
+
+        real_t  _slope  = (real_t) +.10 ;
+
+        double  _pi = 4. * atan(1.) ;
+
+        double  _ttic, _tmarch = 0., _tsweep = 0.;
+        double  _emax = 0., _ebar = 0., _hbar = 0.;
+
+        unsigned long _seed = 1UL ;
+
+    /*-------------------------------- setup grid + h(x) */
+        for (_jpos = 0; _jpos < _xnum; ++_jpos)
+        {
+            if (_kind == JIGSAW_EUCLIDEAN_GRID)
+            _xgrid[_jpos] = (real_t)
+               (_jpos * 1.0 / (_ynum - 1)) ;
+            else
+            _xgrid[_jpos] = (real_t)
+              (-_pi + _jpos * 2.0 * _pi
+                     / (_xnum - 1)) ;
+        }
+
+        for (_ipos = 0; _ipos < _ynum; ++_ipos)
+        {
+            if (_kind == JIGSAW_EUCLIDEAN_GRID)
+            _ygrid[_ipos] = (real_t)
+               (_ipos * 1.0 / (_ynum - 1)) ;
+            else
+            _ygrid[_ipos] = (real_t)
+              (-.5 * _pi + _ipos * 1.0 * _pi
+                          / (_ynum - 1)) ;
+        }
+
+        for (_ipos = 0; _ipos < _nnum; ++_ipos)
+        {
+        /* h = 1 + noise, with a few "fine" spots */
+            _hinit[_ipos] = (real_t)
+               (1. + .5 * rand_real(&_seed)) ;
+
+            if (rand_real(&_seed) < 1.E-04)
+            _hinit[_ipos] = (real_t) +.01 ;
+        }
+
+    /*-------------------------------- run both solvers */
+        for (int _pass = 0; _pass < 2; ++_pass)
+        {
+        jigsaw_jig_t _jjig ;
+        jigsaw_init_jig_t(&_jjig) ;
+
+        jigsaw_msh_t _hfun ;
+        jigsaw_init_msh_t(&_hfun) ;
+
+        real_t *_hdata =
+            _pass == 0 ? _hmarch : _hsweep ;
+
+        memcpy(_hdata, _hinit,
+            _nnum * sizeof(real_t)) ;
+
+        _hfun._flags = _kind ;
+
+        _hfun._xgrid._data = _xgrid ;
+        _hfun._xgrid._size = _xnum ;
+
+        _hfun._ygrid._data = _ygrid ;
+        _hfun._ygrid._size = _ynum ;
+
+        _hfun._value._data = _hdata ;
+        _hfun._value._size = _nnum ;
+
+        _hfun._slope._data = &_slope;
+        _hfun._slope._size = +1 ;
+
+        _hfun._radii._data = NULL ;
+        _hfun._radii._size = +0 ;
+
+        _jjig._verbosity =   +0 ;
+
+        _jjig._hfun_clip = _pass == 0 ?
+            JIGSAW_HFUN_MARCHING :
+            JIGSAW_HFUN_SWEEPING ;
+
+        _jjig._hfun_cpus = _cpus ;
+
+        _ttic = wall_time() ;
+
+        _retv = marche (
+            &_jjig ,    // the config. opts
+            &_hfun ) ;  // the spacing h(x)
+
+        if (_pass == 0)
+            _tmarch = wall_time() - _ttic ;
+        else
+            _tsweep = wall_time() - _ttic ;
+
+        if (_retv != 0) break ;
+        }
+
+    /*-------------------------------- compare solutions */
+        for (_ipos = 0; _ipos < _nnum; ++_ipos)
+        {
+            double _diff = fabs(
+                _hmarch[_ipos] - _hsweep[_ipos]) ;
+
+            _diff /= _hmarch[_ipos] ;
+
+            if (_emax < _diff) _emax = _diff ;
+
+            _ebar += _diff ;
+
+            _hbar += _hsweep[_ipos] ;
+        }
+
+        printf(
+       " %s %d x %d\n",
+            _kind == JIGSAW_EUCLIDEAN_GRID ?
+            "EUCLIDEAN-GRID" : "ELLIPSOID-GRID",
+            (int)_xnum, (int)_ynum) ;
+
+        printf(
+       "   MARCHING:          %8.3f sec.\n",
+            _tmarch) ;
+        printf(
+       "   SWEEPING (CPUS=%d): %8.3f sec.\n",
+            (int)_cpus, _tsweep) ;
+        printf(
+       "   max. |dh|/h:       %8.2e\n",
+            _emax) ;
+        printf(
+       "   mean |dh|/h:       %8.2e\n",
+            _ebar / _nnum) ;
+        printf(
+       "   mean h(x):         %8.5f\n\n",
+            _hbar / _nnum) ;
+
+        free(_xgrid); free(_ygrid);
+        free(_hinit);
+        free(_hmarch); free(_hsweep);
+
+        return _retv ;
+    }
+
+    int main (
+        int          _argc ,
+        char       **_argv
+        )
+    {
+        int _retv = 0;
+
+        indx_t _xnum = +2000 ;
+        indx_t _ynum = +1000 ;
+        indx_t _cpus = +4 ;
+
+        if (_argc > 1) _xnum = atoi(_argv[1]) ;
+        if (_argc > 2) _ynum = atoi(_argv[2]) ;
+        if (_argc > 3) _cpus = atoi(_argv[3]) ;
+
+        if ((_retv = bench_grid(
+                JIGSAW_EUCLIDEAN_GRID,
+                _xnum, _ynum, _cpus)) != 0)
+            return _retv ;
+
+        if ((_retv = bench_grid(
+                JIGSAW_ELLIPSOID_GRID,
+                _xnum, _ynum, _cpus)) != 0)
+            return _retv ;
+
+        printf (
+       "MARCHE returned code : %d \n",_retv);
+
+        return _retv ;
+    }
+
+
+
@@ -0,0 +1,384 @@
+
+//  g++ -std=c++17 -Wall -O3 -march=native -fopenmp
+//  -DUSE_OPENMP bench_2.cpp -o bench_2
+
+//  Micro-benchmark for the geometric predicates: compare
+//  the scalar "float"-"exact" sequence with the batched
+//  "semi"-static filters, reporting ns/predicate and the
+//  fraction of calls resolved by each filter tier, for
+//  both random and near-degenerate inputs (co-linear /
+//  co-spherical sets, perturbed by 1.E-16 to 1.E-06).
+//
+//  bench_2 [NNUM] [REPS]
+
+#   if  defined(  USE_OPENMP)
+#       define  __use_openmp
+#   endif
+
+#   include "../src/libcpp/basebase.hpp"
+#   include "../src/libcpp/mpfloats.hpp"
+#   include "../src/libcpp/geompred.hpp"
+
+#   include <cstdio>
+#   include <cstdlib>
+#   include <vector>
+#   include <chrono>
+
+    int static constexpr _BUFF = +32 ;   // items per ball
+
+    double wall_time (
+        )
+    {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::
+                now().time_since_epoch()).count() ;
+    }
+
+    double rand_real (
+        unsigned long *_seed
+        )
+    {
+    /*-------------------------------- portable LCG in [0,1) */
+       *_seed = (*_seed * 1103515245UL +
+                     12345UL) % 2147483648UL ;
+
+        return (double)*_seed / 2147483648.0 ;
+    }
+
+    /*-------------------------------- scalar kernel adapters */
+
+    double orient2d_1 (double const **_pp)
+    {
+        return geompred::orient2d(
+            _pp[0], _pp[1], _pp[2]) ;
+    }
+    double orient3d_1 (double const **_pp)
+    {
+        return geompred::orient3d(
+            _pp[0], _pp[1], _pp[2], _pp[3]) ;
+    }
+    double inball2d_1 (double const **_pp)
+    {
+        return geompred::inball2d(
+            _pp[0], _pp[1], _pp[2], _pp[3]) ;
+    }
+    double inball2w_1 (double const **_pp)
+    {
+        return geompred::inball2w(
+            _pp[0], _pp[1], _pp[2], _pp[3]) ;
+    }
+    double inball3d_1 (double const **_pp)
+    {
+        return geompred::inball3d(
+            _pp[0], _pp[1], _pp[2], _pp[3], _pp[4]) ;
+    }
+    double inball3w_1 (double const **_pp)
+    {
+        return geompred::inball3w(
+            _pp[0], _pp[1], _pp[2], _pp[3], _pp[4]) ;
+    }
+
+    typedef double (*scal_func) (double const **) ;
+
+    typedef void   (*simd_func) (
+        int, double const *, int ,
+        double const *, double *) ;
+
+    class kern_data
+        {
+        public  :
+        char const     *_name ;
+        int             _npts ;     // incl. query point
+        int             _ndim ;
+        bool            _ball ;     // inball vs. orient
+        bool            _wave ;     // has weights
+        scal_func       _scal ;
+        simd_func       _simd ;
+        int             _kern_f ;
+        int             _kern_e ;
+        int             _kern_s ;
+        } ;
+
+    void make_data (
+        kern_data const&_kern ,
+        int             _nnum ,
+        bool            _degn ,
+        std::vector<double> &_pscl ,    // AoS, per item
+        std::vector<double> &_psoa ,    // SoA, per block
+        std::vector<double> &_pend      // query, per block
+        )
+    {
+    /*-------------------------------- random / degen. sets */
+        unsigned long _seed = 1UL ;
+
+        int _nval = _kern._ndim + (_kern._wave ? 1 : 0) ;
+        int _nblk = _nnum / _BUFF ;
+
+        _pscl.assign(_nnum * _kern._npts * _nval, 0.) ;
+        _psoa.assign(_nblk * _BUFF *
+            (_kern._npts - 1) * _nval, 0.) ;
+        _pend.assign(_nblk * _nval, 0.) ;
+
+        for (int _iblk = 0; _iblk < _nblk; ++_iblk)
+        {
+            double _ppos[_BUFF + 1][4] ;
+            for (int _ipos = 0; _ipos <= _BUFF; ++_ipos)
+            {
+        /*------------------- query is point _BUFF in blk */
+            double  _wval = _kern._wave ?
+                .1 * rand_real(&_seed) : 0. ;
+
+        /*------------------- log-uniform perturbation */
+            double  _pert = (rand_real(&_seed) - .5) *
+                std::pow(10., -6. -
+                    10. * rand_real(&_seed)) ;
+
+            if (!_degn)
+            {
+            for (int _idim = 0; _idim < _kern._ndim; ++_idim)
+                _ppos[_ipos][_idim] = rand_real(&_seed) ;
+            }
+            else
+            if (_kern._ball)
+            {
+        /*------------------- co-spherical in power dist. */
+            double _rsqr = 0. ;
+            for (int _idim = 0; _idim < _kern._ndim; ++_idim)
+            {
+                _ppos[_ipos][_idim] =
+                    rand_real(&_seed) - .5 ;
+                _rsqr += _ppos[_ipos][_idim] *
+                         _ppos[_ipos][_idim] ;
+            }
+            double _scal = std::sqrt(
+                (1. + _wval) / _rsqr) * (1. + _pert) ;
+            for (int _idim = 0; _idim < _kern._ndim; ++_idim)
+                _ppos[_ipos][_idim] =
+                    .5 + _ppos[_ipos][_idim] * _scal ;
+            }
+            else
+            {
+        /*------------------- co-linear / co-planar set */
+            for (int _idim = 0; _idim < _kern._ndim; ++_idim)
+                _ppos[_ipos][_idim] = rand_real(&_seed) ;
+
+            if (_kern._ndim == 2)
+                _ppos[_ipos][1] = .3 +
+                .7 * _ppos[_ipos][0] + _pert ;
+            else
+                _ppos[_ipos][2] = .3 +
+                .5 * _ppos[_ipos][0] +
+                .2 * _ppos[_ipos][1] + _pert ;
+            }
+
+            if (_kern._wave)
+                _ppos[_ipos][_kern._ndim] = _wval ;
+            }
+
+            for (int _ival = 0; _ival < _nval; ++_ival)
+            _pend[_iblk * _nval + _ival] =
+                _ppos[_BUFF][_ival] ;
+
+        /*------------------- items reuse the blk. points */
+            for (int _ipos = 0; _ipos < _BUFF; ++_ipos)
+            {
+            int _item = _iblk * _BUFF + _ipos ;
+            for (int _inod = 0; _inod < _kern._npts; ++_inod)
+            {
+                int _ploc = _inod == _kern._npts - 1 ?
+                    _BUFF : (_ipos + _inod) % _BUFF ;
+
+            for (int _ival = 0; _ival < _nval; ++_ival)
+            {
+                _pscl[(_item * _kern._npts + _inod)
+                        * _nval + _ival] =
+                    _ppos[_ploc][_ival] ;
+
+                if (_inod < _kern._npts - 1)
+                _psoa[_iblk * _BUFF * (_kern._npts - 1)
+                        * _nval +
+                     (_inod * _nval + _ival) * _BUFF +
+                      _ipos] = _ppos[_ploc][_ival] ;
+            }
+            }
+            }
+        }
+    }
+
+    int bench_kern (
+        kern_data const&_kern ,
+        int             _nnum ,
+        int             _reps ,
+        bool            _degn
+        )
+    {
+        std::vector<double> _pscl, _psoa, _pend ;
+        make_data(_kern, _nnum, _degn,
+            _pscl, _psoa, _pend) ;
+
+        int _nval = _kern._ndim + (_kern._wave ? 1 : 0) ;
+        int _nblk = _nnum / _BUFF ;
+        int _nerr = +0 ;
+
+        std::vector<double> _rscl(_nnum), _rsoa(_nnum) ;
+
+        size_t _call[geompred::LASTKERNEL] ;
+
+    /*-------------------------------- scalar filter seq. */
+        for (int _kern_ = 0 ;
+                 _kern_ < geompred::LASTKERNEL; ++_kern_)
+            _call[_kern_] =
+                geompred::_nn_calls[_kern_] ;
+
+        double _ttic = wall_time() ;
+
+        for (int _irep = 0; _irep < _reps; ++_irep)
+        for (int _item = 0; _item < _nnum; ++_item)
+        {
+            double const *_pptr[5] ;
+            for (int _inod = 0; _inod < _kern._npts; ++_inod)
+                _pptr[_inod] = &_pscl[
+                (_item * _kern._npts + _inod) * _nval] ;
+
+            _rscl[_item] = _kern._scal(_pptr) ;
+        }
+
+        double _tscl = wall_time() - _ttic ;
+
+        size_t _sclf =
+            geompred::_nn_calls[_kern._kern_f] -
+                _call[_kern._kern_f] ;
+        size_t _scle =
+            geompred::_nn_calls[_kern._kern_e] -
+                _call[_kern._kern_e] ;
+
+    /*-------------------------------- batched "semi" seq. */
+        for (int _kern_ = 0 ;
+                 _kern_ < geompred::LASTKERNEL; ++_kern_)
+            _call[_kern_] =
+                geompred::_nn_calls[_kern_] ;
+
+        _ttic = wall_time() ;
+
+        for (int _irep = 0; _irep < _reps; ++_irep)
+        for (int _iblk = 0; _iblk < _nblk; ++_iblk)
+        {
+            _kern._simd(_BUFF, &_psoa[
+                _iblk * _BUFF * (_kern._npts - 1) * _nval],
+                _BUFF, &_pend[_iblk * _nval],
+               &_rsoa[_iblk * _BUFF]) ;
+        }
+
+        double _tsoa = wall_time() - _ttic ;
+
+        size_t _soas =
+            geompred::_nn_calls[_kern._kern_s] -
+                _call[_kern._kern_s] ;
+        size_t _soaf =
+            geompred::_nn_calls[_kern._kern_f] -
+                _call[_kern._kern_f] ;
+        size_t _soae =
+            geompred::_nn_calls[_kern._kern_e] -
+                _call[_kern._kern_e] ;
+
+    /*-------------------------------- signs must agree */
+        for (int _item = 0; _item < _nnum; ++_item)
+        {
+            if ((_rscl[_item] > 0.) !=
+                (_rsoa[_item] > 0.) ||
+                (_rscl[_item] < 0.) !=
+                (_rsoa[_item] < 0.) )
+                _nerr += +1 ;
+        }
+
+        double _ncal = (double)_nnum * _reps ;
+
+        printf(
+       " %s %-6s  scalar: %7.2f ns (float %6.2f%%,"
+       " exact %6.2f%%)\n",
+            _kern._name, _degn ? "degen." : "random",
+            _tscl * 1.E+09 / _ncal,
+            100. * (_sclf - _scle) / _ncal,
+            100. * _scle / _ncal) ;
+        printf(
+       " %s %-6s  simd  : %7.2f ns (semi  %6.2f%%,"
+       " float %6.2f%%, exact %6.2f%%)\n",
+            _kern._name, "",
+            _tsoa * 1.E+09 / _ncal,
+            100. * (_soas - _soaf) / _ncal,
+            100. * (_soaf - _soae) / _ncal,
+            100. * _soae / _ncal) ;
+
+        if (_nerr != +0)
+        printf(
+       " %s sign mismatch: %d\n", _kern._name, _nerr) ;
+
+        return _nerr ;
+    }
+
+    int main (
+        int          _argc ,
+        char       **_argv
+        )
+    {
+        int _nnum = 1 << 15 ;
+        int _reps = +20 ;
+
+        if (_argc > 1) _nnum = atoi(_argv[1]) ;
+        if (_argc > 2) _reps = atoi(_argv[2]) ;
+
+        _nnum = std::max(_BUFF,
+            (_nnum / _BUFF) * _BUFF) ;
+
+        kern_data _list[] = {
+    { "ORIENT2D", 3, 2, false, false,
+        orient2d_1, geompred::orient2d,
+        geompred::ORIENT2D_f,
+        geompred::ORIENT2D_e, geompred::ORIENT2D_s } ,
+    { "ORIENT3D", 4, 3, false, false,
+        orient3d_1, geompred::orient3d,
+        geompred::ORIENT3D_f,
+        geompred::ORIENT3D_e, geompred::ORIENT3D_s } ,
+    { "INBALL2D", 4, 2, true , false,
+        inball2d_1, geompred::inball2d,
+        geompred::INBALL2D_f,
+        geompred::INBALL2D_e, geompred::INBALL2D_s } ,
+    { "INBALL2W", 4, 2, true , true ,
+        inball2w_1, geompred::inball2w,
+        geompred::INBALL2W_f,
+        geompred::INBALL2W_e, geompred::INBALL2W_s } ,
+    { "INBALL3D", 5, 3, true , false,
+        inball3d_1, geompred::inball3d,
+        geompred::INBALL3D_f,
+        geompred::INBALL3D_e, geompred::INBALL3D_s } ,
+    { "INBALL3W", 5, 3, true , true ,
+        inball3w_1, geompred::inball3w,
+        geompred::INBALL3W_f,
+        geompred::INBALL3W_e, geompred::INBALL3W_s }
+            } ;
+
+        int _nerr = +0 ;
+
+        mp_float::exactinit() ;
+
+        printf(
+       " GEOMPRED: %d items x %d reps\n\n",
+            _nnum, _reps) ;
+
+        for (auto &_kern : _list)
+        {
+            _nerr += bench_kern(
+                _kern, _nnum, _reps, false) ;
+            _nerr += bench_kern(
+                _kern, _nnum, _reps, true ) ;
+            printf("\n") ;
+        }
+
+        printf (
+       "GEOMPRED returned code : %d \n",_nerr);
+
+        return _nerr ;
+    }
+
+
+
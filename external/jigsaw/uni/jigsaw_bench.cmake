@@ -0,0 +1,219 @@
+
+#   JIGSAW_BENCH.CMAKE: throughput benchmarks for the JIGSAW
+#   cmd-line tools, run via the "jigsaw-bench" target:
+#
+#       cmake --build build --config Release
+#           --target jigsaw-bench
+#
+#   Meshes the geo/ cases at several scales via JIGSAW and
+#   TRIPOD, using STAT_FILE to collect run-time statistics,
+#   runs the uni/ test_*.c scenarios, and times MARCHE via
+#   uni/bench_1.c on a sequence of grids.
+#
+#   Throughput (nodes/sec., or cells/sec. for MARCHE) is
+#   appended to WORK/bench.csv, and compared to the last run
+#   of each case: a drop of more than BENCH_TOL percent is
+#   reported as a regression. Pass -DBENCH_STRICT=ON (when
+#   running this script via cmake -P) to fail on these.
+#
+#   Expects: JIGSAW, TRIPOD, UNI_EXES ('|' separated), ROOT,
+#   WORK.
+
+cmake_minimum_required (VERSION 3.9.4)
+
+if (NOT DEFINED BENCH_TOL)
+  set (BENCH_TOL 10)
+endif ()
+
+file (MAKE_DIRECTORY "${WORK}")
+
+string (TIMESTAMP BENCH_TIME "%Y-%m-%dT%H:%M:%S")
+
+set (BENCH_CSV "${WORK}/bench.csv")
+set (BENCH_BAD 0)
+
+if (EXISTS "${BENCH_CSV}")
+  file (STRINGS "${BENCH_CSV}" BENCH_OLD)
+else ()
+  set (BENCH_OLD)
+  file (WRITE "${BENCH_CSV}" "time,case,size,usec,rate\n")
+endif ()
+
+#-------------------------------- decimal sec. to int. usec.
+#   Takes fixed or exponent form, e.g. "1.25" or "2e-06".
+#   USEC is left empty if SECS can't be parsed.
+function (bench_usec SECS USEC)
+  set (${USEC} "" PARENT_SCOPE)
+  if (NOT "${SECS}" MATCHES
+      "^([0-9]*)(\\.([0-9]*))?([eE]([-+]?[0-9]+))?$")
+    return ()
+  endif ()
+  set (_digs "${CMAKE_MATCH_1}${CMAKE_MATCH_3}")
+  if ("${_digs}" STREQUAL "")
+    return ()
+  endif ()
+  string (LENGTH "${CMAKE_MATCH_3}" _flen)
+  set (_expo 0)
+  if (NOT "${CMAKE_MATCH_5}" STREQUAL "")
+    string (REGEX REPLACE "^[+]?(-?)0*([0-9])" "\\1\\2"
+      _expo "${CMAKE_MATCH_5}")
+  endif ()
+#-------------------------------- digits x 10^(6 + exp - frac)
+  math (EXPR _shft "6 + ${_expo} - ${_flen}")
+  if (_shft GREATER 0)
+    foreach (_ RANGE 1 ${_shft})
+      string (APPEND _digs "0")
+    endforeach ()
+  elseif (_shft LESS 0)
+    string (LENGTH "${_digs}" _dlen)
+    math (EXPR _keep "${_dlen} + ${_shft}")
+    if (_keep GREATER 0)
+      string (SUBSTRING "${_digs}" 0 ${_keep} _digs)
+    else ()
+      set (_digs "0")
+    endif ()
+  endif ()
+  string (REGEX REPLACE "^0+([0-9])" "\\1" _digs "${_digs}")
+  set (${USEC} ${_digs} PARENT_SCOPE)
+endfunction ()
+
+#-------------------------------- log result, check vs. last
+function (bench_push NAME SIZE USEC)
+  if ("${USEC}" STREQUAL "")
+    message (WARNING "bench: ${NAME} has no run-time")
+    set (BENCH_BAD 1 PARENT_SCOPE)
+    return ()
+  endif ()
+  if (USEC LESS 1)
+#-------------------------------- too quick for a rate
+    message (STATUS "bench: ${NAME} ${SIZE} in < 1 usec, skipped")
+    return ()
+  endif ()
+  math (EXPR _rate "(${SIZE} * 1000000) / ${USEC}")
+
+  set (_last 0)
+  foreach (_line IN LISTS BENCH_OLD)
+    if ("${_line}" MATCHES "^[^,]*,${NAME},([0-9]+),([0-9]+),([0-9]+)$")
+      set (_last ${CMAKE_MATCH_3})
+    endif ()
+  endforeach ()
+
+  set (_diff "")
+  if (_last GREATER 0)
+    math (EXPR _pcnt "(100 * (${_rate} - ${_last})) / ${_last}")
+    set (_diff " (${_pcnt}% vs. last)")
+    if (_pcnt LESS -${BENCH_TOL})
+      message (WARNING "bench: ${NAME} regressed${_diff}")
+      set (BENCH_BAD 1 PARENT_SCOPE)
+    endif ()
+  endif ()
+
+  message (STATUS "bench: ${NAME} ${SIZE} in ${USEC} usec, ${_rate}/sec.${_diff}")
+
+  file (APPEND "${BENCH_CSV}"
+    "${BENCH_TIME},${NAME},${SIZE},${USEC},${_rate}\n")
+endfunction ()
+
+#-------------------------------- run JIGSAW/TRIPOD on a .jig
+function (bench_tool TOOL NAME JCFG MESH STAT)
+  execute_process (
+    COMMAND "${TOOL}" "${JCFG}"
+    WORKING_DIRECTORY "${ROOT}"
+    RESULT_VARIABLE _retv OUTPUT_QUIET)
+  if (NOT _retv EQUAL 0)
+    message (WARNING "bench: ${NAME} failed (${_retv})")
+    set (BENCH_BAD 1 PARENT_SCOPE)
+    return ()
+  endif ()
+
+  file (READ "${STAT}" _json)
+  string (REGEX MATCH "\"total-time\": ([-+0-9.eE]+)" _ "${_json}")
+  bench_usec ("${CMAKE_MATCH_1}" _usec)
+
+  file (STRINGS "${MESH}" _npts REGEX "^[Pp][Oo][Ii][Nn][Tt]=")
+  string (REGEX MATCH "([0-9]+)" _ "${_npts}")
+
+  bench_push (${NAME} "${CMAKE_MATCH_1}" "${_usec}")
+  set (BENCH_BAD ${BENCH_BAD} PARENT_SCOPE)
+endfunction ()
+
+#-------------------------------- JIGSAW + TRIPOD geo/ cases
+set (GEO_CASE bunny airfoil)
+set (bunny_DIMS 3)
+set (bunny_HMAX 0.040 0.030 0.022)
+set (airfoil_DIMS 2)
+set (airfoil_HMAX 0.020 0.010 0.005)
+
+foreach (_case IN LISTS GEO_CASE)
+  set (_size 0)
+  foreach (_hmax IN LISTS ${_case}_HMAX)
+    math (EXPR _size "${_size} + 1")
+    set (_name "${_case}-${_size}")
+    set (_base "${WORK}/${_name}")
+
+    file (WRITE "${_base}.jig"
+      "GEOM_FILE = geo/${_case}.msh\n"
+      "MESH_FILE = ${_base}.msh\n"
+      "STAT_FILE = ${_base}.json\n"
+      "MESH_DIMS = ${${_case}_DIMS}\n"
+      "HFUN_SCAL = relative\n"
+      "HFUN_HMAX = ${_hmax}\n")
+
+    bench_tool ("${JIGSAW}" "jigsaw-${_name}"
+      "${_base}.jig" "${_base}.msh" "${_base}.json")
+
+    file (WRITE "${_base}-tri.jig"
+      "GEOM_FILE = geo/${_case}.msh\n"
+      "INIT_FILE = ${_base}.msh\n"
+      "MESH_FILE = ${_base}-tri.msh\n"
+      "STAT_FILE = ${_base}-tri.json\n"
+      "MESH_DIMS = ${${_case}_DIMS}\n")
+
+    bench_tool ("${TRIPOD}" "tripod-${_name}"
+      "${_base}-tri.jig" "${_base}-tri.msh" "${_base}-tri.json")
+  endforeach ()
+endforeach ()
+
+#-------------------------------- uni/ lib-jigsaw scenarios
+string (REPLACE "|" ";" UNI_EXES "${UNI_EXES}")
+
+foreach (_exec IN LISTS UNI_EXES)
+  get_filename_component (_name "${_exec}" NAME_WE)
+  string (REGEX REPLACE "^uni-" "" _name "${_name}")
+
+  if ("${_name}" STREQUAL "bench_1")
+#-------------------------------- MARCHE on XNUM x YNUM grid
+    foreach (_grid 500 1000 2000)
+      math (EXPR _ynum "${_grid} / 2")
+      math (EXPR _cell "${_grid} * ${_ynum}")
+      execute_process (
+        COMMAND "${_exec}" ${_grid} ${_ynum}
+        WORKING_DIRECTORY "${WORK}"
+        RESULT_VARIABLE _retv OUTPUT_VARIABLE _text)
+      if (NOT _retv EQUAL 0)
+        message (WARNING "bench: marche-${_grid} failed (${_retv})")
+        set (BENCH_BAD 1)
+        continue ()
+      endif ()
+      string (REGEX MATCH "SWEEPING[^:]*: *([-+0-9.eE]+)" _ "${_text}")
+      bench_usec ("${CMAKE_MATCH_1}" _usec)
+      bench_push ("marche-${_grid}" ${_cell} "${_usec}")
+    endforeach ()
+  else ()
+#-------------------------------- uni/test_*.c run to pass
+    execute_process (
+      COMMAND "${_exec}"
+      WORKING_DIRECTORY "${WORK}"
+      RESULT_VARIABLE _retv OUTPUT_QUIET)
+    if (NOT _retv EQUAL 0)
+      message (WARNING "bench: ${_name} failed (${_retv})")
+      set (BENCH_BAD 1)
+    else ()
+      message (STATUS "bench: ${_name} passed")
+    endif ()
+  endif ()
+endforeach ()
+
+if (BENCH_BAD AND BENCH_STRICT)
+  message (FATAL_ERROR "bench: failures or regressions found")
+endif ()
@@ -0,0 +1,242 @@
+
+//  gcc -Wall test_10.c
+//  -Xlinker -rpath=../lib
+//  -L ../lib -ljigsaw -o test_10
+
+//  Use TRIPOD to tessellate a (degenerate) grid of nodes,
+//  checking that the MESH_CPUS > 1 "bulk" insertion gives
+//  the same set of cells as the serial case.
+
+#   include "../inc/lib_jigsaw.h"
+
+#   include "stdio.h"
+#   include "stdlib.h"
+
+#   define GRID 60
+
+    int tria_less (
+        void const *_ipos,
+        void const *_jpos
+        )
+    {
+        int const *_ival = (int const*) _ipos ;
+        int const *_jval = (int const*) _jpos ;
+
+        for (int _inod = +0; _inod != +3; ++_inod)
+        {
+            if (_ival[_inod] < _jval[_inod]) return -1 ;
+            if (_ival[_inod] > _jval[_inod]) return +1 ;
+        }
+
+        return +0 ;
+    }
+
+    int grid_indx (
+        jigsaw_msh_t *_mesh,
+        indx_t        _node
+        )
+    {
+    /*-------------------------------- node => grid index */
+        real_t _xpos = _mesh->
+            _vert2._data[_node]._ppos[0] ;
+        real_t _ypos = _mesh->
+            _vert2._data[_node]._ppos[1] ;
+
+        int _ipos = (int)(_xpos * (GRID - 1) + .5) ;
+        int _jpos = (int)(_ypos * (GRID - 1) + .5) ;
+
+        return _ipos * GRID + _jpos ;
+    }
+
+    int *tria_keys (
+        jigsaw_msh_t *_mesh
+        )
+    {
+    /*-------------------------------- sorted cell "keys" */
+        int *_keys = (int *) malloc(
+            3 * _mesh->_tria3._size * sizeof(int)) ;
+
+        for (indx_t _ipos = +0;
+                _ipos != _mesh->_tria3._size ;
+                   ++_ipos )
+        {
+            int *_tkey = &_keys[3 * _ipos] ;
+
+            for (int _inod = +0; _inod != +3; ++_inod)
+            {
+                _tkey[_inod] = grid_indx(_mesh, _mesh->
+                _tria3._data[_ipos]._node[_inod]) ;
+            }
+
+            for (int _inod = +1; _inod != +3; ++_inod)
+            for (int _jnod = _inod; _jnod > +0 &&
+                 _tkey[_jnod - 1] > _tkey[_jnod];
+               --_jnod)
+            {
+                int _temp = _tkey[_jnod - 1];
+                _tkey[_jnod - 1] = _tkey[_jnod] ;
+                _tkey[_jnod] = _temp ;
+            }
+        }
+
+        qsort(_keys, _mesh->_tria3._size,
+            3 * sizeof(int), tria_less) ;
+
+        return _keys ;
+    }
+
+    int main (
+        int          _argc ,
+        char       **_argv
+        )
+    {
+        int _retv = 0;
+
+    /*-------------------------------- setup JIGSAW types */
+        jigsaw_jig_t _jjig ;
+        jigsaw_init_jig_t(&_jjig) ;
+
+        jigsaw_msh_t _geom ;
+        jigsaw_init_msh_t(&_geom) ;
+
+        jigsaw_msh_t _init ;
+        jigsaw_init_msh_t(&_init) ;
+
+        jigsaw_msh_t _mesh[2] ;
+        jigsaw_init_msh_t(&_mesh[0]) ;
+        jigsaw_init_msh_t(&_mesh[1]) ;
+
+    /*
+    --------------------------------------------------------
+     * JIGSAW's "mesh" is a piecewise linear complex:
+    --------------------------------------------------------
+     *
+     *                 e:2
+     *      v:3 o---------------o v:2
+     *          |               |
+     *          |               |
+     *          |               |
+     *      e:3 |               | e:1
+     *          |               |
+     *          |               |
+     *          |               |
+     *      v:0 o---------------o v:1
+     *                 e:0
+     *
+    --------------------------------------------------------
+     */
+
+        jigsaw_VERT2_t _vert2[4] = {    // setup geom.
+            { {0., 0.}, +0 } ,
+            { {1., 0.}, +0 } ,
+            { {1., 1.}, +0 } ,
+            { {0., 1.}, +0 }
+            } ;
+
+        jigsaw_EDGE2_t _edge2[4] = {
+            { {+0, +1}, +0 } ,
+            { {+1, +2}, +0 } ,
+            { {+2, +3}, +0 } ,
+            { {+3, +0}, +0 }
+            } ;
+
+        _geom._flags
+            = JIGSAW_EUCLIDEAN_MESH;
+
+        _geom._vert2._data = &_vert2[0] ;
+        _geom._vert2._size = +4 ;
+
+        _geom._edge2._data = &_edge2[0] ;
+        _geom._edge2._size = +4 ;
+
+    /*-------------------------------- form init. config. */
+
+        jigsaw_VERT2_t _point[GRID * GRID] ;
+
+        for (int _ipos = +0; _ipos != GRID; ++_ipos)
+        for (int _jpos = +0; _jpos != GRID; ++_jpos)
+        {
+            jigsaw_VERT2_t *_node =
+                &_point[_ipos * GRID + _jpos] ;
+
+            _node->_ppos[0] =
+                (real_t) _ipos / (GRID - 1) ;
+            _node->_ppos[1] =
+                (real_t) _jpos / (GRID - 1) ;
+            _node->_itag = +0 ;
+        }
+
+        _init._flags
+            = JIGSAW_EUCLIDEAN_MESH;
+
+        _init._vert2._data = &_point[0] ;
+        _init._vert2._size = GRID * GRID ;
+
+    /*-------------------------------- build TRIPOD r-DT. */
+
+        _jjig._verbosity =   +0 ;
+
+        _jjig._mesh_dims =   +2 ;
+
+        for (int _pass = +0; _pass != +2; ++_pass)
+        {
+        _jjig._mesh_cpus =
+            _pass == +0 ? +1 : +4 ;
+
+        _retv = tripod (
+            &_jjig ,    // the config. opts
+            &_init ,    // init. data
+            &_geom ,    // geom. data
+            &_mesh[_pass]) ;
+
+        if (_retv != +0) break ;
+        }
+
+    /*-------------------------------- compare cell sets */
+
+        if (_retv == +0)
+        {
+        if (_mesh[0]._tria3._size !=
+            _mesh[1]._tria3._size ||
+            _mesh[0]._tria3._size == +0)
+        {
+            _retv = -1 ;
+        }
+        else
+        {
+            int *_kone = tria_keys(&_mesh[0]) ;
+            int *_ktwo = tria_keys(&_mesh[1]) ;
+
+            size_t _diff = +0 ;
+            for (indx_t _ipos = +0;
+                    _ipos != _mesh[0]._tria3._size ;
+                       ++_ipos )
+            {
+                if (tria_less(&_kone[3 * _ipos],
+                              &_ktwo[3 * _ipos]) != +0)
+                    _diff += +1 ;
+            }
+
+            printf("\n TRIA3: %d, DIFF: %d \n\n",
+                (int)_mesh[0]._tria3._size,
+                (int)_diff) ;
+
+            if (_diff != +0) _retv = -1 ;
+
+            free(_kone) ;
+            free(_ktwo) ;
+        }
+        }
+
+        jigsaw_free_msh_t(&_mesh[0]);
+        jigsaw_free_msh_t(&_mesh[1]);
+
+        printf (
+       "JIGSAW returned code : %d \n",_retv);
+
+
+        return _retv ;
+    }
+
+
+
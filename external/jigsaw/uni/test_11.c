@@ -0,0 +1,391 @@
+
+//  gcc -Wall test_11.c
+//  -Xlinker -rpath=../lib
+//  -L ../lib -ljigsaw -o test_11
+
+//  Use JIGSAW to mesh a square domain, then re-mesh it
+//  incrementally (INIT_KEEP) for a new H(x) that is finer
+//  in one corner, checking that no "stale" cells of the
+//  previous mesh are kept, and that cells far from them
+//  are kept bit-for-bit.
+
+#   include "../inc/lib_jigsaw.h"
+
+#   include "stdio.h"
+#   include "stdlib.h"
+#   include "string.h"
+
+#   define HMAX .05
+#   define HLOC .02
+
+#   define GRID 11
+
+#   define FAR_ 0.4
+
+    real_t _hfun_xgrid[GRID] ;
+    real_t _hfun_ygrid[GRID] ;
+    real_t _hfun_value[GRID * GRID] ;
+
+    real_t hfun_eval (
+        real_t const *_ppos
+        )
+    {
+    /*-------------------------------- bilinear grid H(x) */
+        real_t _xpos = _ppos[0] * (GRID - 1) ;
+        real_t _ypos = _ppos[1] * (GRID - 1) ;
+
+        int _ipos = (int)_xpos ;
+        int _jpos = (int)_ypos ;
+
+        if (_ipos < +0) _ipos = +0 ;
+        if (_jpos < +0) _jpos = +0 ;
+        if (_ipos > GRID - 2) _ipos = GRID - 2 ;
+        if (_jpos > GRID - 2) _jpos = GRID - 2 ;
+
+        real_t _xdel = _xpos - _ipos ;
+        real_t _ydel = _ypos - _jpos ;
+
+        real_t const *_hval = _hfun_value ;
+
+        return
+        (1. - _xdel) * (1. - _ydel) *
+            _hval[(_ipos + 0) * GRID + _jpos + 0] +
+        (1. - _xdel) * (0. + _ydel) *
+            _hval[(_ipos + 0) * GRID + _jpos + 1] +
+        (0. + _xdel) * (1. - _ydel) *
+            _hval[(_ipos + 1) * GRID + _jpos + 0] +
+        (0. + _xdel) * (0. + _ydel) *
+            _hval[(_ipos + 1) * GRID + _jpos + 1] ;
+    }
+
+    int tria_long (
+        jigsaw_msh_t *_mesh,
+        indx_t        _tpos,
+        real_t        _scal
+        )
+    {
+    /*-------------------------------- any edge > SCAL*h */
+        indx_t *_tnod =
+            _mesh->_tria3._data[_tpos]._node ;
+
+        for (int _epos = +0; _epos != +3; ++_epos)
+        {
+            real_t const *_ipos = _mesh->_vert2.
+                _data[_tnod[(_epos + 0) % 3]]._ppos ;
+            real_t const *_jpos = _mesh->_vert2.
+                _data[_tnod[(_epos + 1) % 3]]._ppos ;
+
+            real_t _hval = hfun_eval(_ipos) ;
+            real_t _htmp = hfun_eval(_jpos) ;
+            if (_hval < _htmp) _hval = _htmp ;
+
+            _hval *= _scal ;
+
+            real_t _xdel = _ipos[0] - _jpos[0] ;
+            real_t _ydel = _ipos[1] - _jpos[1] ;
+
+            if (_xdel * _xdel + _ydel * _ydel >
+                    _hval * _hval) return +1 ;
+        }
+
+        return +0 ;
+    }
+
+    int coord_less (
+        void const *_ipos,
+        void const *_jpos
+        )
+    {
+        real_t const *_ival = (real_t const*) _ipos ;
+        real_t const *_jval = (real_t const*) _jpos ;
+
+        for (int _idim = +0; _idim != +6; ++_idim)
+        {
+            if (_ival[_idim] < _jval[_idim]) return -1 ;
+            if (_ival[_idim] > _jval[_idim]) return +1 ;
+        }
+
+        return +0 ;
+    }
+
+    void tria_key (
+        jigsaw_msh_t *_mesh,
+        indx_t        _tpos,
+        real_t       *_tkey
+        )
+    {
+    /*-------------------------------- node coord.'s, sorted */
+        for (int _inod = +0; _inod != +3; ++_inod)
+        {
+            indx_t _node = _mesh->
+                _tria3._data[_tpos]._node[_inod] ;
+
+            _tkey[2 * _inod + 0] =
+                _mesh->_vert2._data[_node]._ppos[0] ;
+            _tkey[2 * _inod + 1] =
+                _mesh->_vert2._data[_node]._ppos[1] ;
+        }
+
+        for (int _inod = +1; _inod != +3; ++_inod)
+        for (int _jnod = _inod; _jnod > +0 &&
+             coord_less(&_tkey[2 * _jnod - 2],
+                        &_tkey[2 * _jnod - 0]) > 0 ;
+           --_jnod)
+        {
+            real_t _temp[2] ;
+            memcpy(_temp, &_tkey[2 * _jnod - 2],
+                2 * sizeof(real_t)) ;
+            memcpy(&_tkey[2 * _jnod - 2],
+                   &_tkey[2 * _jnod - 0],
+                2 * sizeof(real_t)) ;
+            memcpy(&_tkey[2 * _jnod - 0], _temp,
+                2 * sizeof(real_t)) ;
+        }
+    }
+
+    int main (
+        int          _argc ,
+        char       **_argv
+        )
+    {
+        int _retv = 0;
+
+    /*-------------------------------- setup JIGSAW types */
+        jigsaw_jig_t _jjig ;
+        jigsaw_init_jig_t(&_jjig) ;
+
+        jigsaw_msh_t _geom ;
+        jigsaw_init_msh_t(&_geom) ;
+
+        jigsaw_msh_t _hfun ;
+        jigsaw_init_msh_t(&_hfun) ;
+
+        jigsaw_msh_t _mesh[2] ;
+        jigsaw_init_msh_t(&_mesh[0]) ;
+        jigsaw_init_msh_t(&_mesh[1]) ;
+
+    /*
+    --------------------------------------------------------
+     * JIGSAW's "mesh" is a piecewise linear complex:
+    --------------------------------------------------------
+     *
+     *                 e:2
+     *      v:3 o---------------o v:2
+     *          |               |
+     *          |               |
+     *          |               |
+     *      e:3 |               | e:1
+     *          |               |
+     *          |               |
+     *          |               |
+     *      v:0 o---------------o v:1
+     *                 e:0
+     *
+    --------------------------------------------------------
+     */
+
+        jigsaw_VERT2_t _vert2[4] = {    // setup geom.
+            { {0., 0.}, +0 } ,
+            { {1., 0.}, +0 } ,
+            { {1., 1.}, +0 } ,
+            { {0., 1.}, +0 }
+            } ;
+
+        jigsaw_EDGE2_t _edge2[4] = {
+            { {+0, +1}, +0 } ,
+            { {+1, +2}, +0 } ,
+            { {+2, +3}, +0 } ,
+            { {+3, +0}, +0 }
+            } ;
+
+        _geom._flags
+            = JIGSAW_EUCLIDEAN_MESH;
+
+        _geom._vert2._data = &_vert2[0] ;
+        _geom._vert2._size = +4 ;
+
+        _geom._edge2._data = &_edge2[0] ;
+        _geom._edge2._size = +4 ;
+
+    /*-------------------------------- finer H(x) in a corner */
+        for (int _ipos = +0; _ipos != GRID; ++_ipos)
+        {
+            _hfun_xgrid[_ipos] =
+                (real_t) _ipos / (GRID - 1) ;
+            _hfun_ygrid[_ipos] =
+                (real_t) _ipos / (GRID - 1) ;
+        }
+
+        for (int _ipos = +0; _ipos != GRID; ++_ipos)
+        for (int _jpos = +0; _jpos != GRID; ++_jpos)
+        {
+            _hfun_value[_ipos * GRID + _jpos] =
+                _hfun_xgrid[_ipos] >= .7 &&
+                _hfun_ygrid[_jpos] >= .7 ? HLOC : HMAX ;
+        }
+
+        _hfun._flags
+            = JIGSAW_EUCLIDEAN_GRID;
+
+        _hfun._xgrid._data = &_hfun_xgrid[0] ;
+        _hfun._xgrid._size = GRID ;
+
+        _hfun._ygrid._data = &_hfun_ygrid[0] ;
+        _hfun._ygrid._size = GRID ;
+
+        _hfun._value._data = &_hfun_value[0] ;
+        _hfun._value._size = GRID * GRID ;
+
+    /*-------------------------------- build, then update */
+
+        _jjig._verbosity =   +0 ;
+
+        _jjig._mesh_dims =   +2 ;
+
+        _jjig._hfun_scal =
+            JIGSAW_HFUN_ABSOLUTE ;
+
+        _jjig._hfun_hmax = HMAX ;
+
+        _retv = jigsaw (
+            &_jjig ,    // the config. opts
+            &_geom ,    // geom. data
+              NULL ,    // empty init. data
+              NULL ,    // empty hfun. data
+            &_mesh[0]) ;
+
+        if (_retv == +0)
+        {
+        _jjig._init_keep = +1 ;
+
+        _retv = jigsaw (
+            &_jjig ,    // the config. opts
+            &_geom ,    // geom. data
+            &_mesh[0] , // prev. mesh data
+            &_hfun ,    // hfun. data
+            &_mesh[1]) ;
+        }
+
+    /*-------------------------------- compare cell sets */
+
+        if (_retv == +0)
+        {
+        if (_mesh[0]._tria3._size == +0 ||
+            _mesh[1]._tria3._size == +0)
+        {
+            _retv = -1 ;
+        }
+        else
+        {
+            indx_t _nold = _mesh[0]._tria3._size ;
+            indx_t _nnew = _mesh[1]._tria3._size ;
+
+            real_t *_knew = (real_t *) malloc(
+                6 * _nnew * sizeof(real_t)) ;
+
+            for (indx_t _ipos = +0;
+                    _ipos != _nnew; ++_ipos)
+            {
+                tria_key(&_mesh[1], _ipos,
+                    &_knew[6 * _ipos]) ;
+            }
+
+            qsort(_knew, _nnew,
+                6 * sizeof(real_t), coord_less) ;
+
+        /*---------------------------- "near"-stale centres */
+            real_t *_bpos = (real_t *) malloc(
+                2 * _nold * sizeof(real_t)) ;
+
+            indx_t _nbad = +0 ;
+            for (indx_t _ipos = +0;
+                    _ipos != _nold; ++_ipos)
+            {
+                if (tria_long(
+                    &_mesh[0], _ipos, .9 * 11./8.))
+                {
+                    real_t _tkey[6] ;
+                    tria_key(&_mesh[0], _ipos, _tkey) ;
+
+                    _bpos[2 * _nbad + 0] = (
+                    _tkey[0] + _tkey[2] + _tkey[4]) / 3. ;
+                    _bpos[2 * _nbad + 1] = (
+                    _tkey[1] + _tkey[3] + _tkey[5]) / 3. ;
+
+                    _nbad += +1 ;
+                }
+            }
+
+            int _nkeep = +0, _nfar_ = +0 ;
+            int _nlost = +0, _nstal = +0 ;
+
+            for (indx_t _ipos = +0;
+                    _ipos != _nold; ++_ipos)
+            {
+                real_t _tkey[6] ;
+                tria_key(&_mesh[0], _ipos, _tkey) ;
+
+                int _kept = bsearch(_tkey, _knew, _nnew,
+                    6 * sizeof(real_t), coord_less)
+                        != NULL ;
+
+                _nkeep += _kept ;
+
+        /*---------------------------- kept cells not stale */
+                if (_kept && tria_long(
+                    &_mesh[0], _ipos, 1.05 * 11./8.))
+                    _nstal += +1 ;
+
+        /*---------------------------- far cells are kept */
+                real_t _xmid = (
+                _tkey[0] + _tkey[2] + _tkey[4]) / 3. ;
+                real_t _ymid = (
+                _tkey[1] + _tkey[3] + _tkey[5]) / 3. ;
+
+                int _far_ = +1 ;
+                for (indx_t _ibad = +0;
+                        _ibad != _nbad; ++_ibad)
+                {
+                    real_t _xdel =
+                        _xmid - _bpos[2 * _ibad + 0] ;
+                    real_t _ydel =
+                        _ymid - _bpos[2 * _ibad + 1] ;
+
+                    if (_xdel * _xdel + _ydel * _ydel <
+                        FAR_ * FAR_)
+                    {
+                        _far_ = +0 ; break ;
+                    }
+                }
+
+                _nfar_ += _far_ ;
+
+                if (_far_ && !_kept) _nlost += +1 ;
+            }
+
+            printf("\n TRIA3: %d, KEEP: %d, STALE: %d, "
+                   "FAR: %d, LOST: %d \n\n",
+                (int)_nnew, _nkeep, _nstal ,
+                _nfar_, _nlost) ;
+
+            if (_nbad == +0 || _nfar_ == +0 ||
+                _nstal != +0 || _nlost != +0)
+                _retv = -1 ;
+
+            free(_knew) ;
+            free(_bpos) ;
+        }
+        }
+
+        jigsaw_free_msh_t(&_mesh[0]);
+        jigsaw_free_msh_t(&_mesh[1]);
+
+        printf (
+       "JIGSAW returned code : %d \n",_retv);
+
+
+        return _retv ;
+    }
+
+
+
@@ -37,6 +37,21 @@ function [varargout] = jigsaw(opts)
 %       node if the separation length is less than NEAR*SCAL
 %       where SCAL is the max. bounding-box dimension.
 %
+%   OPTS.INIT_KEEP - {default = false} treat the initial set
+%       as a previous mesh, and re-mesh it incrementally:
+%       only cells that violate the current H(x), plus a
+%       "halo" of INIT_HALO rings of adj. cells, are re-
+%       meshed. All other cells are kept as-is. Disjoint
+%       regions are re-meshed separately, each grown by
+%       further rings and re-tried if it fails. If any part
+%       still fails, the GEOM. has changed, or INIT_KEEP is
+%       not supported for the mesh type, a full re-build is
+%       done instead.
+%
+%   OPTS.INIT_HALO - {default = 2} number of rings of adj.
+%       cells added about each re-meshed region when
+%       INIT_KEEP is enabled.
+%
 %   OPTIONAL fields (GEOM):
 %   ----------------------
 %
@@ -95,6 +110,11 @@ function [varargout] = jigsaw(opts)
 %       the problem (i.e. if the geometry is 3-dimensional
 %       and DIMS=2 a surface mesh will be produced).
 %
+%   OPTS.MESH_CPUS - {default=1} number of threads used to
+%       build the Delaunay tessellation of the INIT nodes in
+%       TRIPOD (see TRIPOD). JIGSAW always seeds its INIT
+%       nodes serially, and ignores this setting.
+%
 %   OPTS.MESH_KERN - {default='delfront'} meshing kernal,
 %       choice of the standard Delaunay-refinement algorithm
 %       (KERN='delaunay') or the Frontal-Delaunay method
@@ -205,12 +225,34 @@ function [varargout] = jigsaw(opts)
 %   OPTS.OPTM_DIV_ - {default= true} allow for "split" oper-
 %       ations on sub-face topology.
 %
+%   OPTS.OPTM_CPUS - {default=1} number of threads used for
+%       node "smoothing" passes. CPUS > 1 relaxes nodes in
+%       "colour" sets of independent vertices, updating each
+%       set concurrently. Requires an OpenMP-enabled build.
+%       Topological "flip" and "zip" passes remain serial.
+%
 %   OPTIONAL fields (MISC):
 %   ----------------------
 %
 %   OPTS.VERBOSITY - {default=0} verbosity of log-file gene-
 %       rated by JIGSAW. Set VERBOSITY >= 1 for more output.
 %
+%   OPTS.FILE_BINS - {default=false} write MESH_FILE output
+%       in binary *.MSH format, tagged MSHID=3;...;BINARY.
+%       Binary files are much faster to save and load; see
+%       SAVEMSH for details.
+%
+%   OPTS.STAT_FILE - 'STATNAME.JSON', a string containing the
+%       name of a file to which run-time statistics are wri-
+%       tten: stage + iteration timings, predicate, h(x) and
+%       queue counters, and peak memory use, as JSON. Only
+%       written by the cmd-line JIGSAW binary.
+%
+%   If the JIGSAW_MEX gateway has been built (see COMPILE),
+%   calls of the form MESH = JIGSAW(OPTS) are run "in-proc-
+%   ess", passing data to lib_jigsaw directly. No JCFG_FILE
+%   or MESH_FILE is written in this case.
+%
 %   See also LOADMSH, SAVEMSH
 %
 
@@ -262,6 +304,27 @@ function [varargout] = jigsaw(opts)
         error('JIGSAW: invalid input types!!') ;
     end
 
+    if (nargout == +1 && ...
+        exist('jigsaw_mex', 'file') == +3)
+
+%-- call lib_jigsaw in-process via the MEX gateway: skips
+%-- the *.JIG / *.MSH round-trip through the file system
+
+   [varargout{1}, flag] = jigsaw_mex( ...
+        'jigsaw', opts, ...
+        getfile(opts, 'geom_file'), ...
+        getfile(opts, 'init_file'), ...
+        getfile(opts, 'hfun_file')) ;
+
+    if (flag ~= +0)
+        error(['JIGSAW: lib_jigsaw returned FLAG = ', ...
+            num2str(flag)]) ;
+    end
+
+    return ;
+
+    end
+
     savejig(opts.jcfg_file,opts);
 
 %---------------------------- set-up path for "local" binary
@@ -0,0 +1,1281 @@
+//  mex jigsaw_mex.cpp
+//  -Iexternal/jigsaw/inc -Lexternal/jigsaw/lib -ljigsaw
+//  LDFLAGS='$LDFLAGS -Wl,-rpath,external/jigsaw/lib'
+
+//  An "in-process" gateway to JIGSAW's library interface,
+//  called by JIGSAW, TRIPOD and MARCHE when compiled. Mesh
+//  and config. data is passed from MATLAB memory directly
+//  to lib_jigsaw, bypassing *.JIG / *.MSH file i/o. Built
+//  by COMPILE.
+
+//  [MESH,FLAG] = JIGSAW_MEX('jigsaw',OPTS,GEOM,INIT,HFUN)
+//  [MESH,FLAG] = JIGSAW_MEX('tripod',OPTS,INIT,GEOM)
+//  [HFUN,FLAG] = JIGSAW_MEX('marche',OPTS,HFUN)
+//
+//  OPTS is a user-defined set of options, as per JIGSAW.
+//  GEOM, INIT and HFUN may each be a mesh struct. (as per
+//  LOADMSH), the name of a *.MSH file (to be read by the
+//  library), or empty. FLAG is the JIGSAW return code. If
+//  FLAG is not requested, a non-zero code raises an error.
+//
+//  Real-valued arrays (grid coord.'s, VALUE, SLOPE, POWER,
+//  RADII) are passed by reference, not copied, where the
+//  MATLAB layout matches. In MARCHE, VALUE is limited
+//  in-place in the (deep-copied) output struct.
+
+#   include "mex.h"
+
+#   include "lib_jigsaw.h"
+
+#   include <algorithm>
+#   include <cctype>
+#   include <cstring>
+#   include <limits>
+#   include <string>
+
+    /*
+    --------------------------------------------------------
+     * MX-UTIL: helpers for mxArray access.
+    --------------------------------------------------------
+     */
+
+    void mx_fail (
+        char const   *_emsg
+        )
+    {
+        mexErrMsgIdAndTxt("JIGSAW:mex", "%s", _emsg) ;
+    }
+
+    bool mx_empty (
+        mxArray const*_xobj
+        )
+    {
+        return _xobj == nullptr ||
+               mxIsEmpty(_xobj) ;
+    }
+
+    mxArray const* mx_field (
+        mxArray const*_sobj ,
+        char const   *_name
+        )
+    {
+        if (_sobj == nullptr ||
+           !mxIsStruct(_sobj)) return nullptr ;
+
+        return mxGetField(_sobj, 0, _name) ;
+    }
+
+    std::string mx_upper (
+        mxArray const*_xobj
+        )
+    {
+        std::string _sstr ;
+        if (_xobj != nullptr && mxIsChar(_xobj))
+        {
+            char *_cstr = mxArrayToString(_xobj) ;
+            if (_cstr != nullptr)
+            {
+                _sstr.assign(_cstr) ;
+                mxFree(_cstr) ;
+            }
+        }
+
+        std::transform(_sstr.begin(),
+                       _sstr.  end(),
+                       _sstr.begin(),
+            [](unsigned char c){ return
+              (unsigned char)::toupper(c) ; } ) ;
+
+        return _sstr ;
+    }
+
+    mxArray const* mx_double (          // as real double
+        mxArray const*_xobj
+        )
+    {
+        if (mxIsDouble (_xobj) &&
+           !mxIsComplex(_xobj) &&
+           !mxIsSparse (_xobj) )
+            return _xobj ;
+
+        if (!mxIsNumeric(_xobj) &&
+            !mxIsLogical(_xobj) )
+            mx_fail(
+        "JIGSAW_MEX: invalid input types!!") ;
+
+        mxArray *_xdbl = nullptr ;
+        mxArray *_xarg =
+            const_cast<mxArray *>(_xobj) ;
+        mexCallMATLAB(1, &_xdbl,
+                      1, &_xarg, "double") ;
+
+        if (mxIsComplex(_xdbl) ||
+            mxIsSparse (_xdbl) )
+            mx_fail(
+        "JIGSAW_MEX: invalid input types!!") ;
+
+        return _xdbl ;
+    }
+
+    real_t mx_real (
+        mxArray const*_xobj
+        )
+    {
+        if (mx_empty(_xobj) ||
+           (!mxIsNumeric(_xobj) &&
+            !mxIsLogical(_xobj)) )
+            mx_fail(
+        "JIGSAW_MEX: invalid OPTS values!!") ;
+
+        return (real_t) mxGetScalar(_xobj) ;
+    }
+
+    indx_t mx_indx (
+        mxArray const*_xobj
+        )
+    {
+        real_t _xval = mx_real(_xobj) ;
+
+        real_t _imax = (real_t)
+            std::numeric_limits<indx_t>::max() ;
+        real_t _imin = (real_t)
+            std::numeric_limits<indx_t>::min() ;
+
+        if (_xval >= _imax)             // e.g. ITER=inf
+            return std::numeric_limits
+                <indx_t>::max() ;
+        if (_xval <= _imin)
+            return std::numeric_limits
+                <indx_t>::min() ;
+
+        return (indx_t) _xval ;
+    }
+
+    indx_t mx_bool (
+        mxArray const*_xobj
+        )
+    {
+        if (_xobj != nullptr && mxIsChar(_xobj))
+        {
+            std::string _sstr = mx_upper(_xobj) ;
+            if (_sstr.find( "TRUE") !=
+                    std::string::npos)
+                return (indx_t) +1 ;
+            else
+            if (_sstr.find("FALSE") !=
+                    std::string::npos)
+                return (indx_t) +0 ;
+            else
+                mx_fail(
+        "JIGSAW_MEX: invalid OPTS values!!") ;
+        }
+
+        return mx_real(_xobj) != 0. ? +1 : +0 ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * LOAD-JJIG: copy OPTS struct. into JIG_t data.
+    --------------------------------------------------------
+     */
+
+    void load_jjig (
+        mxArray const*_opts ,
+        jigsaw_jig_t &_jjig
+        )
+    {
+        jigsaw_init_jig_t(&_jjig) ;
+
+        if (mx_empty(_opts)) return ;
+
+        if (!mxIsStruct(_opts))
+            mx_fail(
+        "JIGSAW_MEX: invalid OPTS type!!") ;
+
+        int _nfld = mxGetNumberOfFields(_opts) ;
+
+        for (int _ifld = +0; _ifld != _nfld; ++_ifld)
+        {
+            std::string _name(
+            mxGetFieldNameByNumber(_opts, _ifld)) ;
+
+            std::transform(_name.begin(),
+                           _name.  end(),
+                           _name.begin(),
+                [](unsigned char c){ return
+                  (unsigned char)::tolower(c) ; } ) ;
+
+            mxArray const *_xval =
+            mxGetFieldByNumber(_opts, 0, _ifld) ;
+
+    /*------------------------------------- MISC keywords */
+            if (_name == "verbosity")
+                _jjig._verbosity = mx_indx(_xval) ;
+            else
+    /*------------------------------------- BNDS keywords */
+            if (_name == "bnds_kern")
+            {
+                std::string _kern = mx_upper(_xval) ;
+                if (_kern.find("BND-TRIA") !=
+                        std::string::npos)
+                _jjig._bnds_kern = JIGSAW_BNDS_TRIACELL ;
+                else
+                if (_kern.find("BND-DUAL") !=
+                        std::string::npos)
+                _jjig._bnds_kern = JIGSAW_BNDS_DUALCELL ;
+                else
+                mx_fail(
+        "JIGSAW_MEX: invalid BNDS_KERN!!") ;
+            }
+            else
+    /*------------------------------------- GEOM keywords */
+            if (_name == "geom_seed")
+                _jjig._geom_seed = mx_indx(_xval) ;
+            else
+            if (_name == "geom_feat")
+                _jjig._geom_feat = mx_bool(_xval) ;
+            else
+            if (_name == "geom_eta1")
+                _jjig._geom_eta1 = mx_real(_xval) ;
+            else
+            if (_name == "geom_eta2")
+                _jjig._geom_eta2 = mx_real(_xval) ;
+            else
+    /*------------------------------------- INIT keywords */
+            if (_name == "init_near")
+                _jjig._init_near = mx_real(_xval) ;
+            else
+            if (_name == "init_keep")
+                _jjig._init_keep = mx_bool(_xval) ;
+            else
+            if (_name == "init_halo")
+                _jjig._init_halo = mx_indx(_xval) ;
+            else
+    /*------------------------------------- HFUN keywords */
+            if (_name == "hfun_scal")
+            {
+                std::string _scal = mx_upper(_xval) ;
+                if (_scal.find("ABSOLUTE") !=
+                        std::string::npos)
+                _jjig._hfun_scal = JIGSAW_HFUN_ABSOLUTE ;
+                else
+                if (_scal.find("RELATIVE") !=
+                        std::string::npos)
+                _jjig._hfun_scal = JIGSAW_HFUN_RELATIVE ;
+                else
+                mx_fail(
+        "JIGSAW_MEX: invalid HFUN_SCAL!!") ;
+            }
+            else
+            if (_name == "hfun_hmax")
+                _jjig._hfun_hmax = mx_real(_xval) ;
+            else
+            if (_name == "hfun_hmin")
+                _jjig._hfun_hmin = mx_real(_xval) ;
+            else
+            if (_name == "hfun_clip")
+            {
+                std::string _clip = mx_upper(_xval) ;
+                if (_clip.find("MARCHING") !=
+                        std::string::npos)
+                _jjig._hfun_clip = JIGSAW_HFUN_MARCHING ;
+                else
+                if (_clip.find("SWEEPING") !=
+                        std::string::npos)
+                _jjig._hfun_clip = JIGSAW_HFUN_SWEEPING ;
+                else
+                mx_fail(
+        "JIGSAW_MEX: invalid HFUN_CLIP!!") ;
+            }
+            else
+            if (_name == "hfun_cpus")
+                _jjig._hfun_cpus = mx_indx(_xval) ;
+            else
+    /*------------------------------------- MESH keywords */
+            if (_name == "mesh_kern")
+            {
+                std::string _kern = mx_upper(_xval) ;
+                if (_kern.find("DELAUNAY") !=
+                        std::string::npos)
+                _jjig._mesh_kern = JIGSAW_KERN_DELAUNAY ;
+                else
+                if (_kern.find("DELFRONT") !=
+                        std::string::npos)
+                _jjig._mesh_kern = JIGSAW_KERN_DELFRONT ;
+                else
+                if (_kern.find("BISECTOR") !=
+                        std::string::npos)
+                _jjig._mesh_kern = JIGSAW_KERN_BISECTOR ;
+                else
+                mx_fail(
+        "JIGSAW_MEX: invalid MESH_KERN!!") ;
+            }
+            else
+            if (_name == "mesh_dims")
+                _jjig._mesh_dims = mx_indx(_xval) ;
+            else
+            if (_name == "mesh_cpus")
+                _jjig._mesh_cpus = mx_indx(_xval) ;
+            else
+            if (_name == "mesh_iter")
+                _jjig._mesh_iter = mx_indx(_xval) ;
+            else
+            if (_name == "mesh_top1")
+                _jjig._mesh_top1 = mx_bool(_xval) ;
+            else
+            if (_name == "mesh_top2")
+                _jjig._mesh_top2 = mx_bool(_xval) ;
+            else
+            if (_name == "mesh_rad2")
+                _jjig._mesh_rad2 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_rad3")
+                _jjig._mesh_rad3 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_siz1")
+                _jjig._mesh_siz1 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_siz2")
+                _jjig._mesh_siz2 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_siz3")
+                _jjig._mesh_siz3 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_off2")
+                _jjig._mesh_off2 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_off3")
+                _jjig._mesh_off3 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_snk2")
+                _jjig._mesh_snk2 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_snk3")
+                _jjig._mesh_snk3 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_eps1")
+                _jjig._mesh_eps1 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_eps2")
+                _jjig._mesh_eps2 = mx_real(_xval) ;
+            else
+            if (_name == "mesh_vol3")
+                _jjig._mesh_vol3 = mx_real(_xval) ;
+            else
+    /*------------------------------------- OPTM keywords */
+            if (_name == "optm_kern")
+            {
+                std::string _kern = mx_upper(_xval) ;
+                if (_kern.find("ODT+DQDX") !=
+                        std::string::npos)
+                _jjig._optm_kern = JIGSAW_KERN_ODT_DQDX ;
+                else
+                if (_kern.find("CVT+DQDX") !=
+                        std::string::npos)
+                _jjig._optm_kern = JIGSAW_KERN_CVT_DQDX ;
+                else
+                if (_kern.find("H95+DQDX") !=
+                        std::string::npos)
+                _jjig._optm_kern = JIGSAW_KERN_H95_DQDX ;
+                else
+                mx_fail(
+        "JIGSAW_MEX: invalid OPTM_KERN!!") ;
+            }
+            else
+            if (_name == "optm_iter")
+                _jjig._optm_iter = mx_indx(_xval) ;
+            else
+            if (_name == "optm_qtol")
+                _jjig._optm_qtol = mx_real(_xval) ;
+            else
+            if (_name == "optm_qlim")
+                _jjig._optm_qlim = mx_real(_xval) ;
+            else
+            if (_name == "optm_tria")
+                _jjig._optm_tria = mx_bool(_xval) ;
+            else
+            if (_name == "optm_dual")
+                _jjig._optm_dual = mx_bool(_xval) ;
+            else
+            if (_name == "optm_zip_")
+                _jjig._optm_zip_ = mx_bool(_xval) ;
+            else
+            if (_name == "optm_div_")
+                _jjig._optm_div_ = mx_bool(_xval) ;
+            else
+            if (_name == "optm_cpus")
+                _jjig._optm_cpus = mx_indx(_xval) ;
+
+        //  all other fields (*_FILE, etc) are ignored here
+        }
+    }
+
+    /*
+    --------------------------------------------------------
+     * LOAD-JMSH: copy MESH struct. into MSH_t data.
+    --------------------------------------------------------
+     */
+
+    //  Buffers are allocated via mxMalloc and released by
+    //  MATLAB on exit from the gateway, so that errors via
+    //  mexErrMsgIdAndTxt do not leak.
+
+    void load_reals (                   // by ref. if cols=1
+        mxArray const*_xobj ,
+        jigsaw_REALS_array_t &_list
+        )
+    {
+        if (mx_empty(_xobj)) return ;
+
+        _xobj = mx_double(_xobj) ;
+
+        size_t _nrow = mxGetM(_xobj) ;
+        size_t _ncol = mxGetN(_xobj) ;
+
+        real_t *_xptr = mxGetPr(_xobj) ;
+
+        _list._size = _nrow * _ncol ;
+
+        if (_ncol == +1 || _nrow == +1)
+        {
+            _list._data = _xptr ;       // no copy...
+        }
+        else
+        {
+            _list._data = (real_t *)    // to row-major
+                mxMalloc(_list._size * sizeof(real_t));
+
+            for (size_t _irow = +0;
+                    _irow != _nrow; ++_irow)
+            for (size_t _icol = +0;
+                    _icol != _ncol; ++_icol)
+            {
+                _list._data[_irow * _ncol + _icol] =
+                    _xptr[_icol * _nrow + _irow] ;
+            }
+        }
+    }
+
+    void load_grids (                   // by ref. always
+        mxArray const*_xobj ,
+        jigsaw_REALS_array_t &_list
+        )
+    {
+        if (mx_empty(_xobj)) return ;
+
+        _xobj = mx_double(_xobj) ;
+
+        _list._size = mxGetNumberOfElements(_xobj) ;
+        _list._data = mxGetPr(_xobj) ;
+    }
+
+    template <
+    typename      vert_type ,
+    typename      list_type
+             >
+    void load_verts (
+        mxArray const*_xobj ,
+        list_type    &_list ,
+        size_t        _ndim
+        )
+    {
+        size_t _nrow = mxGetM(_xobj) ;
+
+        real_t *_xptr = mxGetPr(_xobj) ;
+
+        _list._size = _nrow ;
+        _list._data = (vert_type *)
+            mxMalloc(_nrow * sizeof(vert_type)) ;
+
+        for (size_t _irow = +0;
+                _irow != _nrow; ++_irow)
+        {
+            for (size_t _idim = +0;
+                    _idim != _ndim; ++_idim)
+            {
+            _list._data[_irow]._ppos[_idim] =
+                _xptr[_idim * _nrow + _irow] ;
+            }
+
+            _list._data[_irow]._itag = (indx_t)
+                _xptr[_ndim * _nrow + _irow] ;
+        }
+    }
+
+    void load_point (
+        mxArray const*_xobj ,
+        jigsaw_VERT2_array_t &_vert2 ,
+        jigsaw_VERT3_array_t &_vert3
+        )
+    {
+        if (mx_empty(_xobj)) return ;
+
+        _xobj = mx_double(_xobj) ;
+
+        size_t _ncol = mxGetN(_xobj) ;
+
+        if (_ncol == +3)
+            load_verts<jigsaw_VERT2_t> (
+                _xobj, _vert2, +2) ;
+        else
+        if (_ncol == +4)
+            load_verts<jigsaw_VERT3_t> (
+                _xobj, _vert3, +3) ;
+        else
+            mx_fail(
+        "JIGSAW_MEX: invalid POINT dimensions!!") ;
+    }
+
+    template <
+    typename      cell_type ,
+    typename      list_type
+             >
+    void load_cells (
+        mxArray const*_sobj ,
+        char const   *_name ,
+        list_type    &_list ,
+        size_t        _nnod
+        )
+    {
+        mxArray const *_xobj =
+            mx_field(mx_field(_sobj, _name), "index") ;
+
+        if (mx_empty(_xobj)) return ;
+
+        _xobj = mx_double(_xobj) ;
+
+        size_t _nrow = mxGetM(_xobj) ;
+        size_t _ncol = mxGetN(_xobj) ;
+
+        if (_ncol != _nnod + 1)
+            mx_fail(
+        "JIGSAW_MEX: invalid INDEX dimensions!!") ;
+
+        real_t *_xptr = mxGetPr(_xobj) ;
+
+        _list._size = _nrow ;
+        _list._data = (cell_type *)
+            mxMalloc(_nrow * sizeof(cell_type)) ;
+
+        for (size_t _irow = +0;
+                _irow != _nrow; ++_irow)
+        {
+            for (size_t _inod = +0;
+                    _inod != _nnod; ++_inod)
+            {
+            _list._data[_irow]._node[_inod] = (indx_t)
+                _xptr[_inod * _nrow + _irow] - 1 ;
+            }
+
+            _list._data[_irow]._itag = (indx_t)
+                _xptr[_nnod * _nrow + _irow] ;
+        }
+    }
+
+    void load_bound (
+        mxArray const*_sobj ,
+        jigsaw_BOUND_array_t &_list
+        )
+    {
+        mxArray const *_xobj =
+            mx_field(mx_field(_sobj, "bound"), "index") ;
+
+        if (mx_empty(_xobj)) return ;
+
+        _xobj = mx_double(_xobj) ;
+
+        size_t _nrow = mxGetM(_xobj) ;
+        size_t _ncol = mxGetN(_xobj) ;
+
+        if (_ncol != +3)
+            mx_fail(
+        "JIGSAW_MEX: invalid BOUND dimensions!!") ;
+
+        real_t *_xptr = mxGetPr(_xobj) ;
+
+        _list._size = _nrow ;
+        _list._data = (jigsaw_BOUND_t *)
+            mxMalloc(_nrow * sizeof(jigsaw_BOUND_t)) ;
+
+        for (size_t _irow = +0;
+                _irow != _nrow; ++_irow)
+        {
+            _list._data[_irow]._itag = (indx_t)
+                _xptr[0 * _nrow + _irow] ;
+            _list._data[_irow]._indx = (indx_t)
+                _xptr[1 * _nrow + _irow] - 1 ;
+            _list._data[_irow]._kind = (indx_t)
+                _xptr[2 * _nrow + _irow] ;
+        }
+    }
+
+    void load_jmsh (
+        mxArray const*_mobj ,
+        jigsaw_msh_t &_jmsh
+        )
+    {
+        if (!mxIsStruct(_mobj))
+            mx_fail(
+        "JIGSAW_MEX: invalid MESH type!!") ;
+
+        std::string _kind =
+            mx_upper(mx_field(_mobj, "mshID")) ;
+
+        if (_kind.empty())
+            _kind = "EUCLIDEAN-MESH" ;
+
+        mxArray const *_xpts =
+            mx_field(mx_field(_mobj, "point"), "coord") ;
+
+        if (_kind == "EUCLIDEAN-MESH" ||
+            _kind == "ELLIPSOID-MESH" )
+        {
+    /*------------------------------------- unstructured */
+            _jmsh._flags = _kind == "EUCLIDEAN-MESH"
+                ? JIGSAW_EUCLIDEAN_MESH
+                : JIGSAW_ELLIPSOID_MESH ;
+
+            load_point(_xpts,
+                _jmsh._vert2, _jmsh._vert3) ;
+
+            load_point(mx_field(
+                mx_field(_mobj, "seeds"), "coord"),
+                _jmsh._seed2, _jmsh._seed3) ;
+
+            load_reals(mx_field(
+                mx_field(_mobj, "point"), "power"),
+                _jmsh._power) ;
+
+            load_cells<jigsaw_EDGE2_t>(
+                _mobj, "edge2", _jmsh._edge2, +2) ;
+            load_cells<jigsaw_TRIA3_t>(
+                _mobj, "tria3", _jmsh._tria3, +3) ;
+            load_cells<jigsaw_QUAD4_t>(
+                _mobj, "quad4", _jmsh._quad4, +4) ;
+            load_cells<jigsaw_TRIA4_t>(
+                _mobj, "tria4", _jmsh._tria4, +4) ;
+            load_cells<jigsaw_HEXA8_t>(
+                _mobj, "hexa8", _jmsh._hexa8, +8) ;
+            load_cells<jigsaw_WEDG6_t>(
+                _mobj, "wedg6", _jmsh._wedg6, +6) ;
+            load_cells<jigsaw_PYRA5_t>(
+                _mobj, "pyra5", _jmsh._pyra5, +5) ;
+
+            load_bound(_mobj, _jmsh._bound) ;
+
+            load_reals(mx_field(_mobj, "value"),
+                       _jmsh._value) ;
+            load_reals(mx_field(_mobj, "slope"),
+                       _jmsh._slope) ;
+        }
+        else
+        if (_kind == "EUCLIDEAN-GRID" ||
+            _kind == "ELLIPSOID-GRID" )
+        {
+    /*------------------------------------- structured   */
+            _jmsh._flags = _kind == "EUCLIDEAN-GRID"
+                ? JIGSAW_EUCLIDEAN_GRID
+                : JIGSAW_ELLIPSOID_GRID ;
+
+            if (!mx_empty(_xpts))
+            {
+            if (!mxIsCell(_xpts))
+                mx_fail(
+        "JIGSAW_MEX: invalid COORD type!!") ;
+
+            size_t _ndim =
+                mxGetNumberOfElements(_xpts) ;
+
+            if (_ndim >= +1)
+                load_grids(mxGetCell(_xpts, 0),
+                           _jmsh._xgrid) ;
+            if (_ndim >= +2)
+                load_grids(mxGetCell(_xpts, 1),
+                           _jmsh._ygrid) ;
+            if (_ndim >= +3)
+                load_grids(mxGetCell(_xpts, 2),
+                           _jmsh._zgrid) ;
+            }
+
+            load_grids(mx_field(_mobj, "value"),
+                       _jmsh._value) ;
+            load_grids(mx_field(_mobj, "slope"),
+                       _jmsh._slope) ;
+        }
+        else
+            mx_fail(
+        "JIGSAW_MEX: invalid MSHID!!") ;
+
+        load_grids(mx_field(_mobj, "radii"),
+                   _jmsh._radii) ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * SAVE-JMSH: copy MSH_t data into MESH struct.
+    --------------------------------------------------------
+     */
+
+    void push_field (
+        mxArray      *_sobj ,
+        char const   *_name ,
+        mxArray      *_xobj
+        )
+    {
+        if (mxGetFieldNumber(_sobj, _name) < 0)
+            mxAddField(_sobj, _name) ;
+
+        mxSetField(_sobj, 0, _name, _xobj) ;
+    }
+
+    mxArray* make_struct (
+        )
+    {
+        return mxCreateStructMatrix(1, 1, 0, nullptr) ;
+    }
+
+    mxArray* save_reals (               // to [nrow x ncol]
+        jigsaw_REALS_array_t const&_list ,
+        size_t        _nrow
+        )
+    {
+        if (_nrow == +0) _nrow = _list._size ;
+
+        size_t _ncol = _list._size / _nrow ;
+
+        mxArray *_xobj =
+            mxCreateDoubleMatrix(_nrow, _ncol, mxREAL) ;
+
+        real_t *_xptr = mxGetPr(_xobj) ;
+
+        for (size_t _irow = +0;
+                _irow != _nrow; ++_irow)
+        for (size_t _icol = +0;
+                _icol != _ncol; ++_icol)
+        {
+            _xptr[_icol * _nrow + _irow] =
+                _list._data[_irow * _ncol + _icol] ;
+        }
+
+        return _xobj ;
+    }
+
+    template <
+    typename      list_type
+             >
+    mxArray* save_verts (
+        list_type const&_list ,
+        size_t        _ndim
+        )
+    {
+        size_t _nrow = _list._size ;
+
+        mxArray *_xobj = mxCreateDoubleMatrix(
+            _nrow, _ndim + 1, mxREAL) ;
+
+        real_t *_xptr = mxGetPr(_xobj) ;
+
+        for (size_t _irow = +0;
+                _irow != _nrow; ++_irow)
+        {
+            for (size_t _idim = +0;
+                    _idim != _ndim; ++_idim)
+            {
+            _xptr[_idim * _nrow + _irow] =
+                _list._data[_irow]._ppos[_idim] ;
+            }
+
+            _xptr[_ndim * _nrow + _irow] = (real_t)
+                _list._data[_irow]._itag ;
+        }
+
+        return _xobj ;
+    }
+
+    template <
+    typename      list_type
+             >
+    void save_cells (
+        mxArray      *_mobj ,
+        char const   *_name ,
+        list_type const&_list ,
+        size_t        _nnod
+        )
+    {
+        if (_list._size == +0) return ;
+
+        size_t _nrow = _list._size ;
+
+        mxArray *_xobj = mxCreateDoubleMatrix(
+            _nrow, _nnod + 1, mxREAL) ;
+
+        real_t *_xptr = mxGetPr(_xobj) ;
+
+        for (size_t _irow = +0;
+                _irow != _nrow; ++_irow)
+        {
+            for (size_t _inod = +0;
+                    _inod != _nnod; ++_inod)
+            {
+            _xptr[_inod * _nrow + _irow] = (real_t)
+                _list._data[_irow]._node[_inod] + 1 ;
+            }
+
+            _xptr[_nnod * _nrow + _irow] = (real_t)
+                _list._data[_irow]._itag ;
+        }
+
+        mxArray *_sobj = make_struct() ;
+        push_field(_sobj, "index", _xobj) ;
+        push_field(_mobj, _name, _sobj) ;
+    }
+
+    void save_bound (
+        mxArray      *_mobj ,
+        jigsaw_BOUND_array_t const&_list
+        )
+    {
+        if (_list._size == +0) return ;
+
+        size_t _nrow = _list._size ;
+
+        mxArray *_xobj =
+            mxCreateDoubleMatrix(_nrow, 3, mxREAL) ;
+
+        real_t *_xptr = mxGetPr(_xobj) ;
+
+        for (size_t _irow = +0;
+                _irow != _nrow; ++_irow)
+        {
+            _xptr[0 * _nrow + _irow] = (real_t)
+                _list._data[_irow]._itag ;
+            _xptr[1 * _nrow + _irow] = (real_t)
+                _list._data[_irow]._indx + 1 ;
+            _xptr[2 * _nrow + _irow] = (real_t)
+                _list._data[_irow]._kind ;
+        }
+
+        mxArray *_sobj = make_struct() ;
+        push_field(_sobj, "index", _xobj) ;
+        push_field(_mobj, "bound", _sobj) ;
+    }
+
+    mxArray* save_grids (               // to [ny x nx x..]
+        jigsaw_REALS_array_t const&_list ,
+        jigsaw_msh_t const&_jmsh
+        )
+    {
+        mwSize _dims[4] = {
+            (mwSize)_jmsh._ygrid._size,
+            (mwSize)_jmsh._xgrid._size, 1, 1 } ;
+        mwSize _ndim = +2 ;
+
+        if (_jmsh._zgrid._size > +0)
+        {
+            _dims[_ndim++] = _jmsh._zgrid._size ;
+        }
+
+        size_t _nval = +1 ;
+        for (mwSize _idim = +0;
+                _idim != _ndim; ++_idim)
+            _nval *= _dims[_idim] ;
+
+        if (_nval == +0 || _list._size % _nval != 0)
+        {
+            _dims[0] = _list._size;     // not a "grid"
+            _dims[1] = 1; _ndim = 2 ;
+        }
+        else
+        if (_list._size / _nval > +1)
+        {
+            _dims[_ndim++] = _list._size / _nval ;
+        }
+
+        mxArray *_xobj = mxCreateNumericArray(
+            _ndim, _dims, mxDOUBLE_CLASS, mxREAL) ;
+
+        std::memcpy(mxGetPr(_xobj), _list._data,
+            _list._size * sizeof(real_t)) ;
+
+        return _xobj ;
+    }
+
+    mxArray* save_jmsh (
+        jigsaw_msh_t const&_jmsh
+        )
+    {
+        mxArray *_mobj = make_struct() ;
+
+        if (_jmsh._flags == JIGSAW_EUCLIDEAN_GRID ||
+            _jmsh._flags == JIGSAW_ELLIPSOID_GRID )
+        {
+    /*------------------------------------- structured   */
+            if (_jmsh._radii._size > +0)
+                push_field(_mobj, "radii",
+                    save_reals(_jmsh._radii, 1)) ;
+
+            jigsaw_REALS_array_t const *_grid[3] = {
+                &_jmsh._xgrid ,
+                &_jmsh._ygrid ,
+                &_jmsh._zgrid } ;
+
+            mwSize _ndim = _jmsh._zgrid._size > +0
+                ? +3 : +2 ;
+
+            mxArray *_xpts =
+                mxCreateCellMatrix(1, _ndim) ;
+
+            for (mwSize _idim = +0;
+                    _idim != _ndim; ++_idim)
+            {
+                mxSetCell(_xpts, _idim,
+                    save_reals(*_grid[_idim], 0)) ;
+            }
+
+            mxArray *_sobj = make_struct() ;
+            push_field(_sobj, "coord", _xpts) ;
+            push_field(_mobj, "point", _sobj) ;
+
+            if (_jmsh._value._size > +0)
+                push_field(_mobj, "value",
+                    save_grids(_jmsh._value, _jmsh)) ;
+
+            if (_jmsh._slope._size > +0)
+                push_field(_mobj, "slope",
+                    save_grids(_jmsh._slope, _jmsh)) ;
+
+            push_field(_mobj, "mshID",
+                mxCreateString(
+                _jmsh._flags == JIGSAW_EUCLIDEAN_GRID
+                    ? "euclidean-grid"
+                    : "ellipsoid-grid" )) ;
+        }
+        else
+        {
+    /*------------------------------------- unstructured */
+            if (_jmsh._radii._size > +0)
+                push_field(_mobj, "radii",
+                    save_reals(_jmsh._radii, 1)) ;
+
+            size_t _npts = +0 ;
+
+            if (_jmsh._vert2._size > +0 ||
+                _jmsh._vert3._size > +0 )
+            {
+                mxArray *_sobj = make_struct() ;
+
+                if (_jmsh._vert2._size > +0)
+                {
+                    _npts = _jmsh._vert2._size ;
+                    push_field(_sobj, "coord",
+                        save_verts(_jmsh._vert2, 2)) ;
+                }
+                else
+                {
+                    _npts = _jmsh._vert3._size ;
+                    push_field(_sobj, "coord",
+                        save_verts(_jmsh._vert3, 3)) ;
+                }
+
+                if (_jmsh._power._size > +0)
+                    push_field(_sobj, "power",
+                        save_reals(_jmsh._power, _npts)) ;
+
+                push_field(_mobj, "point", _sobj) ;
+            }
+
+            if (_jmsh._seed2._size > +0 ||
+                _jmsh._seed3._size > +0 )
+            {
+                mxArray *_sobj = make_struct() ;
+
+                if (_jmsh._seed2._size > +0)
+                    push_field(_sobj, "coord",
+                        save_verts(_jmsh._seed2, 2)) ;
+                else
+                    push_field(_sobj, "coord",
+                        save_verts(_jmsh._seed3, 3)) ;
+
+                push_field(_mobj, "seeds", _sobj) ;
+            }
+
+            save_cells(_mobj, "edge2", _jmsh._edge2, 2) ;
+            save_cells(_mobj, "tria3", _jmsh._tria3, 3) ;
+            save_cells(_mobj, "quad4", _jmsh._quad4, 4) ;
+            save_cells(_mobj, "tria4", _jmsh._tria4, 4) ;
+            save_cells(_mobj, "hexa8", _jmsh._hexa8, 8) ;
+            save_cells(_mobj, "wedg6", _jmsh._wedg6, 6) ;
+            save_cells(_mobj, "pyra5", _jmsh._pyra5, 5) ;
+
+            save_bound(_mobj, _jmsh._bound) ;
+
+            if (_jmsh._value._size > +0)
+                push_field(_mobj, "value",
+                    save_reals(_jmsh._value, _npts)) ;
+
+            if (_jmsh._slope._size > +0)
+                push_field(_mobj, "slope",
+                    save_reals(_jmsh._slope, _npts)) ;
+
+            push_field(_mobj, "mshID",
+                mxCreateString(
+                _jmsh._flags == JIGSAW_ELLIPSOID_MESH
+                    ? "ellipsoid-mesh"
+                    : "euclidean-mesh" )) ;
+        }
+
+        push_field(_mobj, "fileV",
+            mxCreateDoubleScalar(+3.)) ;
+
+        return _mobj ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * JMSH-DATA: a MSH_t input, from struct. or file.
+    --------------------------------------------------------
+     */
+
+    class jmsh_data
+        {
+        public  :
+        jigsaw_msh_t          _jmsh ;
+        bool                  _file ;   // lib.-allocated?
+        bool                  _none ;
+
+        public  :
+        jmsh_data (
+            ) : _file(false), _none(true)
+        {
+            jigsaw_init_msh_t(&this->_jmsh) ;
+        }
+
+        ~jmsh_data (
+            )
+        {
+            if (this->_file)
+            jigsaw_free_msh_t(&this->_jmsh) ;
+        }
+
+        jigsaw_msh_t* ptr (
+            )
+        {
+            return this->_none
+                ? nullptr : &this->_jmsh ;
+        }
+        } ;
+
+    indx_t load_data (
+        mxArray const*_xobj ,
+        jmsh_data    &_data
+        )
+    {
+        if (mx_empty(_xobj)) return JIGSAW_NO_ERROR ;
+
+        _data._none = false ;
+
+        if (mxIsChar(_xobj))
+        {
+    /*------------------------------------- read via lib. */
+            char *_fstr = mxArrayToString(_xobj) ;
+
+            _data._file = true ;
+
+            indx_t _retv =
+                jigsaw_load_msh_t(_fstr, &_data._jmsh) ;
+
+            if (_retv != JIGSAW_NO_ERROR)
+                mexWarnMsgIdAndTxt("JIGSAW:mex",
+                "JIGSAW_MEX: error reading %s", _fstr) ;
+
+            mxFree(_fstr) ;
+
+            return _retv ;
+        }
+        else
+        if (mxIsStruct(_xobj))
+        {
+    /*------------------------------------- pass by ref.  */
+            load_jmsh(_xobj, _data._jmsh) ;
+
+            return JIGSAW_NO_ERROR ;
+        }
+
+        mx_fail("JIGSAW_MEX: invalid input types!!") ;
+
+        return JIGSAW_INVALID_ARGUMENT ;
+    }
+
+    /*
+    --------------------------------------------------------
+     * MEX-FUNCTION: the gateway.
+    --------------------------------------------------------
+     */
+
+    void mexFunction (
+        int           _nout ,
+        mxArray      *_pout [] ,
+        int           _narg ,
+        mxArray const*_parg []
+        )
+    {
+        if (_narg < +2 || !mxIsChar(_parg[0]))
+            mx_fail(
+        "JIGSAW_MEX: insufficient inputs!!") ;
+
+        if (_nout > +2)
+            mx_fail(
+        "JIGSAW_MEX: too many outputs!!") ;
+
+        #define __argv(__ipos)              \
+           (_narg > (__ipos) ? _parg[__ipos] : nullptr)
+
+        std::string _kind = mx_upper(_parg[0]) ;
+
+        jigsaw_jig_t _jjig ;
+        load_jjig(_parg[1], _jjig) ;
+
+        indx_t   _retv = JIGSAW_NO_ERROR ;
+        mxArray *_mobj = nullptr ;
+
+        if (_kind == "JIGSAW")
+        {
+    /*------------------------------------- call JIGSAW   */
+            jmsh_data _geom, _init, _hfun ;
+
+            if (_retv == JIGSAW_NO_ERROR)
+            _retv = load_data(__argv(2), _geom) ;
+            if (_retv == JIGSAW_NO_ERROR)
+            _retv = load_data(__argv(3), _init) ;
+            if (_retv == JIGSAW_NO_ERROR)
+            _retv = load_data(__argv(4), _hfun) ;
+
+            if (_retv == JIGSAW_NO_ERROR)
+            {
+                jigsaw_msh_t _mesh ;
+                jigsaw_init_msh_t(&_mesh) ;
+
+                _retv = jigsaw(&_jjig,
+                    _geom.ptr(), _init.ptr(),
+                    _hfun.ptr(), &_mesh) ;
+
+                if (_retv == JIGSAW_NO_ERROR)
+                    _mobj = save_jmsh(_mesh) ;
+
+                jigsaw_free_msh_t(&_mesh) ;
+            }
+        }
+        else
+        if (_kind == "TRIPOD")
+        {
+    /*------------------------------------- call TRIPOD   */
+            jmsh_data _init, _geom ;
+
+            if (_retv == JIGSAW_NO_ERROR)
+            _retv = load_data(__argv(2), _init) ;
+            if (_retv == JIGSAW_NO_ERROR)
+            _retv = load_data(__argv(3), _geom) ;
+
+            if (_retv == JIGSAW_NO_ERROR)
+            {
+                jigsaw_msh_t _mesh ;
+                jigsaw_init_msh_t(&_mesh) ;
+
+                _retv = tripod(&_jjig,
+                    _init.ptr(), _geom.ptr(),
+                    &_mesh) ;
+
+                if (_retv == JIGSAW_NO_ERROR)
+                    _mobj = save_jmsh(_mesh) ;
+
+                jigsaw_free_msh_t(&_mesh) ;
+            }
+        }
+        else
+        if (_kind == "MARCHE")
+        {
+    /*------------------------------------- call MARCHE   */
+            mxArray const *_xobj = __argv(2) ;
+
+            if (mx_empty(_xobj))
+                mx_fail(
+        "JIGSAW_MEX: insufficient inputs!!") ;
+
+            if (mxIsStruct(_xobj))
+            {
+        //  limit VALUE in-place in a copy of the input, so
+        //  that the output is written with no extra pass
+
+                _mobj = mxDuplicateArray(_xobj) ;
+
+                mxArray *_xval =
+                    mxGetField(_mobj, 0, "value") ;
+
+                if (!mx_empty(_xval) &&
+                    !mxIsDouble(_xval))
+                    push_field(_mobj, "value",
+                    mxDuplicateArray(mx_double(_xval)));
+
+                jigsaw_msh_t _ffun ;
+                jigsaw_init_msh_t(&_ffun) ;
+
+                load_jmsh(_mobj, _ffun) ;
+
+                real_t *_vptr = mxGetPr(
+                    mxGetField(_mobj, 0, "value")) ;
+
+                if (_ffun._value._size > +0 &&
+                    _ffun._value._data != _vptr)
+                    mx_fail(
+        "JIGSAW_MEX: invalid VALUE dimensions!!") ;
+
+                _retv = marche(&_jjig, &_ffun) ;
+            }
+            else
+            {
+                jmsh_data _ffun ;
+
+                _retv = load_data(_xobj, _ffun) ;
+
+                if (_retv == JIGSAW_NO_ERROR)
+                _retv = marche(&_jjig, _ffun.ptr()) ;
+
+                if (_retv == JIGSAW_NO_ERROR)
+                    _mobj = save_jmsh(_ffun._jmsh) ;
+            }
+        }
+        else
+            mx_fail(
+        "JIGSAW_MEX: invalid KIND, expecting "
+            "'jigsaw', 'tripod' or 'marche'!!") ;
+
+        #undef  __argv
+
+    /*------------------------------------- push outputs  */
+        if (_retv != JIGSAW_NO_ERROR &&
+            _mobj != nullptr)
+        {
+            mxDestroyArray(_mobj) ;
+            _mobj  = nullptr ;
+        }
+
+        if (_retv != JIGSAW_NO_ERROR &&
+            _nout <  +2)
+        {
+    /*------------------------------------- FLAG not taken */
+            mexErrMsgIdAndTxt("JIGSAW:mex",
+        "JIGSAW_MEX: %s returned FLAG = %d!!",
+                _kind.c_str(), (int) _retv) ;
+        }
+
+        if (_mobj == nullptr)
+            _mobj = mxCreateDoubleMatrix(0, 0, mxREAL) ;
+
+        _pout[0] = _mobj ;
+
+        if (_nout >= +2)
+            _pout[1] = mxCreateDoubleScalar(
+                (double) _retv) ;
+    }
+
+
@@ -47,6 +47,13 @@ function [opts] = loadjig(name)
             case 'bnds_file'
             opts .bnds_file = strtrim(tstr{2});
 
+            case 'file_bins'
+            opts .file_bins = ...
+                strcmpi(strtrim(tstr{2}), 'true');
+
+            case 'stat_file'
+            opts .stat_file = strtrim(tstr{2});
+
         %-------------------------------------- INIT options
             case 'init_file'
             opts .init_file = strtrim(tstr{2});
@@ -54,6 +61,13 @@ function [opts] = loadjig(name)
             case 'init_near'
             opts .init_near = str2double(tstr{2});
 
+            case 'init_keep'
+            opts .init_keep = ...
+                strcmpi(strtrim(tstr{2}), 'true');
+
+            case 'init_halo'
+            opts .init_halo = str2double(tstr{2});
+
         %-------------------------------------- GEOM options
             case 'geom_file'
             opts .geom_file = strtrim(tstr{2});
@@ -87,6 +101,11 @@ function [opts] = loadjig(name)
             case 'hfun_hmin'
             opts .hfun_hmin = str2double(tstr{2});
 
+            case 'hfun_clip'
+            opts .hfun_clip = strtrim(tstr{2});
+            case 'hfun_cpus'
+            opts .hfun_cpus = str2double(tstr{2});
+
         %-------------------------------------- BNDS options
             case 'bnds_kern'
             opts .bnds_kern = strtrim(tstr{2});
@@ -107,6 +126,9 @@ function [opts] = loadjig(name)
             case 'mesh_dims'
             opts .mesh_dims = str2double(tstr{2});
 
+            case 'mesh_cpus'
+            opts .mesh_cpus = str2double(tstr{2});
+
             case 'mesh_top1'
             opts .mesh_top1 = ...
                 strcmpi(strtrim(tstr{2}), 'true');
@@ -169,6 +191,9 @@ function [opts] = loadjig(name)
             opts .optm_dual = ...
                 strcmpi(strtrim(tstr{2}), 'true');
 
+            case 'optm_cpus'
+            opts .optm_cpus = str2double(tstr{2});
+
             end
 
         end
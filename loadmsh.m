@@ -100,6 +100,9 @@ function [mesh] = loadmsh(name)
 %       gradient-limits ||dh/dx|| used by the Eikonal solver
 %       MARCHE.
 %
+%   Binary files, tagged via MSHID=3;...;BINARY, are detected
+%   automatically (see SAVEMSH).
+%
 %   See also JIGSAW, SAVEMSH
 %
 
@@ -115,7 +118,7 @@ function [mesh] = loadmsh(name)
 
     try
 
-    ffid = fopen(name,'r') ;
+    ffid = fopen(name,'r','ieee-le') ;
 
     real = '%f;' ;
     ints = '%i;' ;
@@ -129,6 +132,8 @@ function [mesh] = loadmsh(name)
     nver = +0 ;
     ndim = +0 ;
 
+    bins = false ;
+
     while (true)
 
     %-- read next line from file
@@ -167,6 +172,11 @@ function [mesh] = loadmsh(name)
                     strtrim(upper(stag{2}));
                 end
 
+                if (length(stag) >= +3)
+                    bins = strcmpi( ...
+                    strtrim(stag{3}),'binary') ;
+                end
+
             case 'ndims'
 
         %-- read "NDIMS" data
@@ -209,8 +219,19 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum*(ndim+1);
 
+                if (bins)
+               [xpos,have] = ...
+                fread(ffid,[ndim,nnum],'float64') ;
+               [itag,done] = ...
+                fread(ffid,[ +1 ,nnum],'int32') ;
+
+                data = [xpos; itag] ;
+                data = data(:) ;
+                have = have + done ;
+                else
                [data,have] = ...
             fscanf(ffid,[repmat(real,1,ndim),'%i'],numr);
+                end
 
                 if (have ~= numr)
 
@@ -241,8 +262,19 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum*(ndim+1);
 
+                if (bins)
+               [xpos,have] = ...
+                fread(ffid,[ndim,nnum],'float64') ;
+               [itag,done] = ...
+                fread(ffid,[ +1 ,nnum],'int32') ;
+
+                data = [xpos; itag] ;
+                data = data(:) ;
+                have = have + done ;
+                else
                [data,have] = ...
             fscanf(ffid,[repmat(real,1,ndim),'%i'],numr);
+                end
 
                 if (have ~= numr)
 
@@ -277,7 +309,7 @@ function [mesh] = loadmsh(name)
                 ndim = max(ndim,idim);
 
                [data,have] = ...
-                    fscanf(ffid,'%f',cnum) ;
+                readblk(ffid,bins,'%f',cnum,'float64') ;
 
                 if (have ~= cnum)
 
@@ -296,8 +328,8 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum * 3;
 
-               [data,have] = ...
-            fscanf(ffid,[repmat(ints,1,2),'%i'],numr);
+               [data,have] = readblk(ffid,bins, ...
+            [repmat(ints,1,2),'%i'],numr,'int32') ;
 
                 if (have ~= numr)
 
@@ -322,8 +354,8 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum * 4;
 
-               [data,have] = ...
-            fscanf(ffid,[repmat(ints,1,3),'%i'],numr);
+               [data,have] = readblk(ffid,bins, ...
+            [repmat(ints,1,3),'%i'],numr,'int32') ;
 
                 if (have ~= numr)
 
@@ -349,8 +381,8 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum * 5;
 
-               [data,have] = ...
-            fscanf(ffid,[repmat(ints,1,4),'%i'],numr);
+               [data,have] = readblk(ffid,bins, ...
+            [repmat(ints,1,4),'%i'],numr,'int32') ;
 
                 if (have ~= numr)
 
@@ -377,8 +409,8 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum * 5;
 
-               [data,have] = ...
-            fscanf(ffid,[repmat(ints,1,4),'%i'],numr);
+               [data,have] = readblk(ffid,bins, ...
+            [repmat(ints,1,4),'%i'],numr,'int32') ;
 
                 if (have ~= numr)
 
@@ -405,8 +437,8 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum * 9;
 
-               [data,have] = ...
-            fscanf(ffid,[repmat(ints,1,8),'%i'],numr);
+               [data,have] = readblk(ffid,bins, ...
+            [repmat(ints,1,8),'%i'],numr,'int32') ;
 
                 if (have ~= numr)
 
@@ -437,8 +469,8 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum * 7;
 
-               [data,have] = ...
-            fscanf(ffid,[repmat(ints,1,6),'%i'],numr);
+               [data,have] = readblk(ffid,bins, ...
+            [repmat(ints,1,6),'%i'],numr,'int32') ;
 
                 if (have ~= numr)
 
@@ -467,8 +499,8 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum * 6;
 
-               [data,have] = ...
-            fscanf(ffid,[repmat(ints,1,5),'%i'],numr);
+               [data,have] = readblk(ffid,bins, ...
+            [repmat(ints,1,5),'%i'],numr,'int32') ;
 
                 if (have ~= numr)
 
@@ -496,8 +528,8 @@ function [mesh] = loadmsh(name)
 
                 numr = nnum * 3;
 
-               [data,have] = ...
-            fscanf(ffid,[repmat(ints,1,2),'%i'],numr);
+               [data,have] = readblk(ffid,bins, ...
+            [repmat(ints,1,2),'%i'],numr,'int32') ;
 
                 if (have ~= numr)
 
@@ -536,8 +568,8 @@ function [mesh] = loadmsh(name)
 
                 fstr = repmat(real,1,vnum) ;
 
-               [data,have] = fscanf( ...
-                  ffid,fstr(1:end-1),numr) ;
+               [data,have] = readblk(ffid,bins, ...
+                  fstr(1:end-1),numr,'float64') ;
 
                 if (have ~= numr)
 
@@ -577,8 +609,8 @@ function [mesh] = loadmsh(name)
 
                 fstr = repmat(real,1,pnum) ;
 
-               [data,have] = fscanf( ...
-                  ffid,fstr(1:end-1),numr) ;
+               [data,have] = readblk(ffid,bins, ...
+                  fstr(1:end-1),numr,'float64') ;
 
                 if (have ~= numr)
 
@@ -619,8 +651,8 @@ function [mesh] = loadmsh(name)
 
                 fstr = repmat(real,1,vnum) ;
 
-               [data,have] = fscanf( ...
-                  ffid,fstr(1:end-1),numr) ;
+               [data,have] = readblk(ffid,bins, ...
+                  fstr(1:end-1),numr,'float64') ;
 
                 if (have ~= numr)
 
@@ -728,5 +760,14 @@ function [mesh] = loadmsh(name)
 
 end
 
+function [data,have] = readblk(ffid,bins,fstr,numr,kind)
+%READBLK read NUMR values from an ascii or binary section
 
+    if (bins)
+       [data,have] = fread(ffid,numr,kind) ;
+    else
+       [data,have] = fscanf(ffid,fstr,numr) ;
+    end
+
+end
 
@@ -26,12 +26,40 @@ function [varargout] = marche(opts)
 %   OPTS.JCFG_FILE - 'JCFGNAME.JIG', a string containing the
 %       name of the cofig. file (will be created on output).
 %
+%   OPTIONAL fields (HFUN):
+%   ----------------------
+%
+%   OPTS.HFUN_CLIP - {default='marching'} solver used to im-
+%       pose the gradient-limits. CLIP='marching' is a ser-
+%       ial, heap-based "fast-marching" method. CLIP='sweep-
+%       ing' is a tiled "fast-sweeping" method, run in para-
+%       llel over HFUN_CPUS threads. 'sweeping' applies to
+%       2-dim. EUCLIDEAN-GRID and ELLIPSOID-GRID h(x) only,
+%       falling back to 'marching' for unstructured h(x).
+%       It is ignored (with a notice in the log) for 3-dim.
+%       EUCLIDEAN-GRID h(x), for which gradient-limits are
+%       not supported by either solver.
+%
+%   OPTS.HFUN_CPUS - {default=1} number of threads used for
+%       CLIP='sweeping'. Requires an OpenMP-enabled build.
+%
 %   OPTIONAL fields (MISC):
 %   ----------------------
 %
 %   OPTS.VERBOSITY - {default=0} verbosity of log-file gene-
 %       rated by JIGSAW. Set VERBOSITY >= 1 for more output.
 %
+%   OPTS.STAT_FILE - 'STATNAME.JSON', a string containing the
+%       name of a file to which run-time statistics are wri-
+%       tten: stage + iteration timings, predicate, h(x) and
+%       queue counters, and peak memory use, as JSON. Only
+%       written by the cmd-line MARCHE binary.
+%
+%   If the JIGSAW_MEX gateway has been built (see COMPILE),
+%   calls of the form HFUN = MARCHE(OPTS) are run "in-proc-
+%   ess", passing data to lib_jigsaw directly. HFUN_FILE is
+%   not overwritten in this case, and no JCFG_FILE is made.
+%
 %   See also LOADMSH, SAVEMSH
 %
 
@@ -53,6 +81,24 @@ function [varargout] = marche(opts)
         error('MARCHE: invalid input types!!') ;
     end
 
+    if (nargout == +1 && ...
+        exist('jigsaw_mex', 'file') == +3)
+
+%-- call lib_jigsaw in-process via the MEX gateway: skips
+%-- the *.JIG / *.MSH round-trip through the file system
+
+   [varargout{1}, flag] = jigsaw_mex( ...
+        'marche', opts, getfile(opts, 'hfun_file')) ;
+
+    if (flag ~= +0)
+        error(['MARCHE: lib_jigsaw returned FLAG = ', ...
+            num2str(flag)]) ;
+    end
+
+    return ;
+
+    end
+
     savejig(opts.jcfg_file,opts);
 
 %---------------------------- set-up path for "local" binary
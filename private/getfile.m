@@ -0,0 +1,25 @@
+function [name] = getfile(opts,field)
+%GETFILE return OPTS.FIELD, or [] if not present.
+%
+%   A (private) helper for the JIGSAW_MEX calls in JIGSAW,
+%   TRIPOD and MARCHE.
+%
+%   See also JIGSAW, TRIPOD, MARCHE
+
+%-----------------------------------------------------------
+%   Darren Engwirda
+%   github.com/dengwirda/jigsaw-matlab
+%   18-Oct-2026
+%   d.engwirda@gmail.com
+%-----------------------------------------------------------
+%
+
+    name = [] ;
+    if (isfield(opts,field))
+        name = opts.(field) ;
+    end
+
+end
+
+
+
@@ -43,6 +43,12 @@ function savejig(name,opts)
         case 'bnds_file'
         pushchar(ffid,opts.bnds_file,'BNDS_FILE');
 
+        case 'file_bins'
+        pushbool(ffid,opts.file_bins,'FILE_BINS');
+
+        case 'stat_file'
+        pushchar(ffid,opts.stat_file,'STAT_FILE');
+
         case 'jcfg_file' ;
 
     %------------------------------------------ INIT options
@@ -52,6 +58,12 @@ function savejig(name,opts)
         case 'init_near'
         pushreal(ffid,opts.init_near,'INIT-NEAR');
 
+        case 'init_keep'
+        pushbool(ffid,opts.init_keep,'INIT_KEEP');
+
+        case 'init_halo'
+        pushints(ffid,opts.init_halo,'INIT_HALO');
+
     %------------------------------------------ GEOM options
         case 'geom_file'
         pushchar(ffid,opts.geom_file,'GEOM_FILE');
@@ -84,6 +96,11 @@ function savejig(name,opts)
         case 'hfun_hmin'
         pushreal(ffid,opts.hfun_hmin,'HFUN_HMIN');
 
+        case 'hfun_clip'
+        pushchar(ffid,opts.hfun_clip,'HFUN_CLIP');
+        case 'hfun_cpus'
+        pushints(ffid,opts.hfun_cpus,'HFUN_CPUS');
+
     %------------------------------------------ BNDS options
         case 'bnds_kern'
         pushchar(ffid,opts.bnds_kern,'BNDS_KERN');
@@ -104,6 +121,9 @@ function savejig(name,opts)
         case 'mesh_dims'
         pushints(ffid,opts.mesh_dims,'MESH_DIMS');
 
+        case 'mesh_cpus'
+        pushints(ffid,opts.mesh_cpus,'MESH_CPUS');
+
         case 'mesh_top1'
         pushbool(ffid,opts.mesh_top1,'MESH_TOP1');
         case 'mesh_top2'
@@ -160,6 +180,9 @@ function savejig(name,opts)
         case 'optm_dual'
         pushbool(ffid,opts.optm_dual,'OPTM_DUAL');
 
+        case 'optm_cpus'
+        pushints(ffid,opts.optm_cpus,'OPTM_CPUS');
+
 
     %------------------------------------------ abandoned OP
         case{'hfun_kern', ...
@@ -101,6 +101,13 @@ function savemsh(name,mesh,varargin)
 %       gradient-limits ||dh/dx|| used by the Eikonal solver
 %       MARCHE.
 %
+%   SAVEMSH(NAME,MESH,'BINARY') writes data sections as raw
+%   little-endian blocks (reals as float64, indexing/tags as
+%   int32) following each header line, which is padded so
+%   that each block begins on an 8-byte offset. Such files
+%   are tagged via MSHID=3;...;BINARY and can be read by
+%   LOADMSH and by JIGSAW directly.
+%
 %   See also JIGSAW, LOADMSH
 %
 
@@ -123,6 +130,16 @@ function savemsh(name,mesh,varargin)
 
    [path,file,fext] = fileparts(name) ;
 
+    bins = false ;
+    for iarg = +1 : length(varargin)
+        if (ischar(varargin{iarg}) && ...
+            strcmpi(varargin{iarg},'binary'))
+            bins = true ;
+        else
+            error('Invalid SAVEMSH option!') ;
+        end
+    end
+
     if(~strcmp(lower(fext),'.msh'))
         name = [name,'.msh'];
     end
@@ -130,7 +147,7 @@ function savemsh(name,mesh,varargin)
     try
 %-- try to write data to file
 
-    ffid = fopen(name, 'w') ;
+    ffid = fopen(name, 'w', 'ieee-le') ;
 
     nver = +3;
 
@@ -152,20 +169,20 @@ function savemsh(name,mesh,varargin)
 
     case 'EUCLIDEAN-MESH'
         save_mesh_format( ...
-            ffid,nver,mesh,'EUCLIDEAN-MESH') ;
+            ffid,nver,mesh,'EUCLIDEAN-MESH',bins) ;
     case 'EUCLIDEAN-GRID'
         save_grid_format( ...
-            ffid,nver,mesh,'EUCLIDEAN-GRID') ;
+            ffid,nver,mesh,'EUCLIDEAN-GRID',bins) ;
     case 'EUCLIDEAN-DUAL'
        %save_dual_format( ...
        %    ffid,nver,mesh,'EUCLIDEAN-DUAL') ;
 
     case 'ELLIPSOID-MESH'
         save_mesh_format( ...
-            ffid,nver,mesh,'ELLIPSOID-MESH') ;
+            ffid,nver,mesh,'ELLIPSOID-MESH',bins) ;
     case 'ELLIPSOID-GRID'
         save_grid_format( ...
-            ffid,nver,mesh,'ELLIPSOID-GRID') ;
+            ffid,nver,mesh,'ELLIPSOID-GRID',bins) ;
     case 'ELLIPSOID-DUAL'
        %save_dual_format( ...
        %    ffid,nver,mesh,'ELLIPSOID-DUAL') ;
@@ -189,17 +206,17 @@ function savemsh(name,mesh,varargin)
 
 end
 
-function save_mesh_format(ffid,nver,mesh,kind)
+function save_mesh_format(ffid,nver,mesh,kind,bins)
 %SAVE-MESH-FORMAT save mesh data in unstructured-mesh format
 
     switch (upper(kind))
     case 'EUCLIDEAN-MESH'
             fprintf( ...
-        ffid,'MSHID=%u;EUCLIDEAN-MESH\n',nver) ;
+        ffid,'MSHID=%u;EUCLIDEAN-MESH%s\n',nver,btag(bins)) ;
 
     case 'ELLIPSOID-MESH'
             fprintf( ...
-        ffid,'MSHID=%u;ELLIPSOID-MESH\n',nver) ;
+        ffid,'MSHID=%u;ELLIPSOID-MESH%s\n',nver,btag(bins)) ;
 
     end
 
@@ -241,8 +258,8 @@ function save_mesh_format(ffid,nver,mesh,kind)
         npts = size(mesh.point.coord,1)-0 ;
         fprintf(ffid,['NDIMS=%u','\n'],ndim);
 
-        fprintf(ffid, ...
-            ['POINT=%u','\n'],size(mesh.point.coord,1));
+        save_head(ffid,bins, ...
+            sprintf('POINT=%u',size(mesh.point.coord,1)));
 
         if (isa(mesh.point.coord,'double'))
             vstr = sprintf('%%1.%ug;',+17);
@@ -250,8 +267,13 @@ function save_mesh_format(ffid,nver,mesh,kind)
             vstr = sprintf('%%1.%ug;',+ 9);
         end
 
+        if (bins)
+        fwrite(ffid,mesh.point.coord(:,1:ndim)','float64');
+        fwrite(ffid,mesh.point.coord(:,ndim+1),'int32');
+        else
         fprintf(ffid, ...
         [repmat(vstr,1,ndim),'%i\n'],mesh.point.coord');
+        end
 
     end
 
@@ -270,8 +292,8 @@ function save_mesh_format(ffid,nver,mesh,kind)
 
         sdim = size(mesh.seeds.coord,2)-1 ;
 
-        fprintf(ffid, ...
-            ['SEEDS=%u','\n'],size(mesh.seeds.coord,1));
+        save_head(ffid,bins, ...
+            sprintf('SEEDS=%u',size(mesh.seeds.coord,1)));
 
         if (isa(mesh.seeds.coord,'double'))
             vstr = sprintf('%%1.%ug;',+17);
@@ -279,8 +301,13 @@ function save_mesh_format(ffid,nver,mesh,kind)
             vstr = sprintf('%%1.%ug;',+ 9);
         end
 
+        if (bins)
+        fwrite(ffid,mesh.seeds.coord(:,1:sdim)','float64');
+        fwrite(ffid,mesh.seeds.coord(:,sdim+1),'int32');
+        else
         fprintf(ffid, ...
         [repmat(vstr,1,sdim),'%i\n'],mesh.seeds.coord');
+        end
 
     end
 
@@ -307,9 +334,14 @@ function save_mesh_format(ffid,nver,mesh,kind)
         end
         vstr = repmat(vstr,+1,npwr) ;
 
-        fprintf(ffid,['POWER=%u;%u','\n'],[nrow,npwr]);
+        save_head(ffid,bins, ...
+            sprintf('POWER=%u;%u',[nrow,npwr])) ;
+        if (bins)
+        fwrite(ffid,mesh.point.power','float64');
+        else
         fprintf(ffid, ...
             [vstr(+1:end-1), '\n'], mesh.point.power');
+        end
 
     end
 
@@ -341,8 +373,13 @@ function save_mesh_format(ffid,nver,mesh,kind)
         end
         vstr = repmat(vstr,+1,nval) ;
 
-        fprintf(ffid,['VALUE=%u;%u','\n'],[nrow,nval]);
+        save_head(ffid,bins, ...
+            sprintf('VALUE=%u;%u',[nrow,nval])) ;
+        if (bins)
+        fwrite(ffid,mesh.value','float64');
+        else
         fprintf(ffid,[vstr(1:end-1),'\n'],mesh.value');
+        end
 
     end
 
@@ -375,8 +412,13 @@ function save_mesh_format(ffid,nver,mesh,kind)
         end
         vstr = repmat(vstr,+1,nval) ;
 
-        fprintf(ffid,['SLOPE=%u;%u','\n'],[nrow,nval]);
+        save_head(ffid,bins, ...
+            sprintf('SLOPE=%u;%u',[nrow,nval])) ;
+        if (bins)
+        fwrite(ffid,mesh.slope','float64');
+        else
         fprintf(ffid,[vstr(1:end-1),'\n'],mesh.slope');
+        end
 
     end
 
@@ -403,10 +445,15 @@ function save_mesh_format(ffid,nver,mesh,kind)
         index(:,1:2) = ...
         index(:,1:2)-1 ; % zero-indexing!
 
-        fprintf( ...
-        ffid,['EDGE2=%u','\n'],size(index,1)) ;
+        save_head(ffid,bins, ...
+            sprintf('EDGE2=%u',size(index,1))) ;
+
+        if (bins)
+        fwrite(ffid,index','int32') ;
+        else
         fprintf(ffid, ...
         [repmat('%u;',1,2),'%i','\n'],index') ;
+        end
 
     end
 
@@ -433,11 +480,15 @@ function save_mesh_format(ffid,nver,mesh,kind)
         index(:,1:3) = ...
         index(:,1:3)-1 ; % zero-indexing!
 
-        fprintf( ...
-        ffid,['TRIA3=%u','\n'],size(index,1)) ;
+        save_head(ffid,bins, ...
+            sprintf('TRIA3=%u',size(index,1))) ;
 
+        if (bins)
+        fwrite(ffid,index','int32') ;
+        else
         fprintf(ffid, ...
         [repmat('%u;',1,3),'%i','\n'],index') ;
+        end
 
     end
 
@@ -464,11 +515,15 @@ function save_mesh_format(ffid,nver,mesh,kind)
         index(:,1:4) = ...
         index(:,1:4)-1 ; % zero-indexing!
 
-        fprintf( ...
-        ffid,['QUAD4=%u','\n'],size(index,1)) ;
+        save_head(ffid,bins, ...
+            sprintf('QUAD4=%u',size(index,1))) ;
 
+        if (bins)
+        fwrite(ffid,index','int32') ;
+        else
         fprintf(ffid, ...
         [repmat('%u;',1,4),'%i','\n'],index') ;
+        end
 
     end
 
@@ -495,11 +550,15 @@ function save_mesh_format(ffid,nver,mesh,kind)
         index(:,1:4) = ...
         index(:,1:4)-1 ; % zero-indexing!
 
-        fprintf( ...
-        ffid,['TRIA4=%u','\n'],size(index,1)) ;
+        save_head(ffid,bins, ...
+            sprintf('TRIA4=%u',size(index,1))) ;
 
+        if (bins)
+        fwrite(ffid,index','int32') ;
+        else
         fprintf(ffid, ...
         [repmat('%u;',1,4),'%i','\n'],index') ;
+        end
 
     end
 
@@ -526,11 +585,15 @@ function save_mesh_format(ffid,nver,mesh,kind)
         index(:,1:8) = ...
         index(:,1:8)-1 ; % zero-indexing!
 
-        fprintf( ...
-        ffid,['HEXA8=%u','\n'],size(index,1)) ;
+        save_head(ffid,bins, ...
+            sprintf('HEXA8=%u',size(index,1))) ;
 
+        if (bins)
+        fwrite(ffid,index','int32') ;
+        else
         fprintf(ffid, ...
         [repmat('%u;',1,8),'%i','\n'],index') ;
+        end
 
     end
 
@@ -557,11 +620,15 @@ function save_mesh_format(ffid,nver,mesh,kind)
         index(:,1:6) = ...
         index(:,1:6)-1 ; % zero-indexing!
 
-        fprintf( ...
-        ffid,['WEDG6=%u','\n'],size(index,1)) ;
+        save_head(ffid,bins, ...
+            sprintf('WEDG6=%u',size(index,1))) ;
 
+        if (bins)
+        fwrite(ffid,index','int32') ;
+        else
         fprintf(ffid, ...
         [repmat('%u;',1,6),'%i','\n'],index') ;
+        end
 
     end
 
@@ -588,11 +655,15 @@ function save_mesh_format(ffid,nver,mesh,kind)
         index(:,1:5) = ...
         index(:,1:5)-1 ; % zero-indexing!
 
-        fprintf( ...
-        ffid,['PYRA5=%u','\n'],size(index,1)) ;
+        save_head(ffid,bins, ...
+            sprintf('PYRA5=%u',size(index,1))) ;
 
+        if (bins)
+        fwrite(ffid,index','int32') ;
+        else
         fprintf(ffid, ...
         [repmat('%u;',1,6),'%i','\n'],index') ;
+        end
 
     end
 
@@ -613,27 +684,31 @@ function save_mesh_format(ffid,nver,mesh,kind)
         index(:,2:2) = ...
         index(:,2:2)-1 ; % zero-indexing!
 
-        fprintf( ...
-        ffid,['BOUND=%u','\n'],size(index,1)) ;
+        save_head(ffid,bins, ...
+            sprintf('BOUND=%u',size(index,1))) ;
 
+        if (bins)
+        fwrite(ffid,index','int32') ;
+        else
         fprintf(ffid, ...
         [repmat('%u;',1,2),'%u','\n'],index') ;
+        end
 
     end
 
 end
 
-function save_grid_format(ffid,nver,mesh,kind)
+function save_grid_format(ffid,nver,mesh,kind,bins)
 %SAVE-GRID-FORMAT save mesh class in rectilinear-grid format
 
     switch (upper(kind))
     case 'EUCLIDEAN-GRID'
             fprintf( ...
-        ffid,'MSHID=%u;EUCLIDEAN-GRID\n',nver) ;
+        ffid,'MSHID=%u;EUCLIDEAN-GRID%s\n',nver,btag(bins)) ;
 
     case 'ELLIPSOID-GRID'
             fprintf( ...
-        ffid,'MSHID=%u;ELLIPSOID-GRID\n',nver) ;
+        ffid,'MSHID=%u;ELLIPSOID-GRID%s\n',nver,btag(bins)) ;
 
     end
 
@@ -695,10 +770,14 @@ function save_grid_format(ffid,nver,mesh,kind)
             vstr = sprintf('%%1.%ug\n',+ 9);
         end
 
-        fprintf(ffid,...
-        'COORD=%u;%u\n', [idim,dims(iord(idim))]);
+        save_head(ffid,bins, ...
+        sprintf('COORD=%u;%u',[idim,dims(iord(idim))]));
 
+        if (bins)
+        fwrite(ffid,mesh.point.coord{idim},'float64');
+        else
         fprintf(ffid,vstr,mesh.point.coord{idim});
+        end
 
     end
 
@@ -747,10 +826,14 @@ function save_grid_format(ffid,nver,mesh,kind)
         vals = ...
         reshape(mesh.value,[],nval(end)) ;
 
-        fprintf(ffid, ...
-          'VALUE=%u;%u\n',[prod(dims),nval(end)]);
+        save_head(ffid,bins, ...
+          sprintf('VALUE=%u;%u',[prod(dims),nval(end)]));
 
+        if (bins)
+        fwrite(ffid,vals','float64');
+        else
         fprintf(ffid,[vstr(+1:end-1),'\n'],vals');
+        end
 
     end
 
@@ -797,14 +880,40 @@ function save_grid_format(ffid,nver,mesh,kind)
         vals = ...
         reshape(mesh.slope,[],nval(end)) ;
 
-        fprintf(ffid, ...
-          'SLOPE=%u;%u\n',[prod(dims),nval(end)]);
+        save_head(ffid,bins, ...
+          sprintf('SLOPE=%u;%u',[prod(dims),nval(end)]));
 
+        if (bins)
+        fwrite(ffid,vals','float64');
+        else
         fprintf(ffid,[vstr(+1:end-1),'\n'],vals');
+        end
 
     end
 
 end
 
+function [tstr] = btag(bins)
+%BTAG return the MSHID suffix for binary files
 
+    if (bins)
+        tstr = ';BINARY' ;
+    else
+        tstr = '' ;
+    end
+
+end
+
+function save_head(ffid,bins,hstr)
+%SAVE-HEAD write section header, padding binary blocks so
+%that data begins on an 8-byte file offset
+
+    if (bins)
+        fill = mod(-(ftell(ffid)+length(hstr)+1),8);
+        fprintf(ffid,'%s\n',[hstr,blanks(fill)]) ;
+    else
+        fprintf(ffid,'%s\n',hstr) ;
+    end
+
+end
 
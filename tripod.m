@@ -63,12 +63,31 @@ function [varargout] = tripod(opts)
 %       the problem (i.e. if the geometry is 3-dimensional
 %       and DIMS=2 a surface mesh will be produced).
 %
+%   OPTS.MESH_CPUS - {default=1} number of threads used to
+%       build the Delaunay tessellation of the INIT nodes in
+%       TRIPOD. CPUS > 1 searches for node "cavities" concur-
+%       rently, but inserts nodes in the same order as CPUS=1,
+%       giving an identical tessellation, including for "de-
+%       generate" inputs (e.g. structured grids). Requires an
+%       OpenMP-enabled build.
+%
 %   OPTIONAL fields (MISC):
 %   ----------------------
 %
 %   OPTS.VERBOSITY - {default=0} verbosity of log-file gene-
 %       rated by JIGSAW. Set VERBOSITY >= 1 for more output.
 %
+%   OPTS.STAT_FILE - 'STATNAME.JSON', a string containing the
+%       name of a file to which run-time statistics are wri-
+%       tten: stage + iteration timings, predicate, h(x) and
+%       queue counters, and peak memory use, as JSON. Only
+%       written by the cmd-line TRIPOD binary.
+%
+%   If the JIGSAW_MEX gateway has been built (see COMPILE),
+%   calls of the form MESH = TRIPOD(OPTS) are run "in-proc-
+%   ess", passing data to lib_jigsaw directly. No JCFG_FILE
+%   or MESH_FILE is written in this case.
+%
 %   See also LOADMSH, SAVEMSH
 %
 
@@ -90,6 +109,26 @@ function [varargout] = tripod(opts)
         error('TRIPOD: invalid input types!!') ;
     end
 
+    if (nargout == +1 && ...
+        exist('jigsaw_mex', 'file') == +3)
+
+%-- call lib_jigsaw in-process via the MEX gateway: skips
+%-- the *.JIG / *.MSH round-trip through the file system
+
+   [varargout{1}, flag] = jigsaw_mex( ...
+        'tripod', opts, ...
+        getfile(opts, 'init_file'), ...
+        getfile(opts, 'geom_file')) ;
+
+    if (flag ~= +0)
+        error(['TRIPOD: lib_jigsaw returned FLAG = ', ...
+            num2str(flag)]) ;
+    end
+
+    return ;
+
+    end
+
     savejig(opts.jcfg_file,opts);
 
 %---------------------------- set-up path for "local" binary